@@ -1291,6 +1291,11 @@
   #endif
   #define JD_HANDLE_SMALL_SEGMENTS    // Use curvature estimation instead of just the junction angle
                                       // for small segments (< 1mm) with large junction angles (> 135°).
+  //#define JD_CURVATURE_WINDOW 6     // Limit speed on curves made of short segments to keep the centripetal
+                                      // acceleration in bounds, estimating the curvature over this many blocks.
+  #ifdef JD_CURVATURE_WINDOW
+    #define JD_CURVATURE_SEGMENT_MM 2 // (mm) Longest block treated as part of a curve
+  #endif
 #endif
 
 /**
@@ -1302,6 +1307,13 @@
  * See https://github.com/synthetos/TinyG/wiki/Jerk-Controlled-Motion-Explained
  */
 // #define S_CURVE_ACCELERATION
+#if ENABLED(S_CURVE_ACCELERATION)
+  //#define S_CURVE_JERK_LIMITED          // Plan constant-jerk (7-segment) ramps that never exceed the acceleration,
+                                        // instead of fitting a Bézier curve into the trapezoid ramp time.
+  #if ENABLED(S_CURVE_JERK_LIMITED)
+    #define S_CURVE_MAX_JERK 100000     // (mm/s^3) Rate of change of the acceleration
+  #endif
+#endif
 
 //===========================================================================
 //============================= Z Probe Options =============================
@@ -1918,6 +1930,13 @@
       #define BILINEAR_SUBDIVISIONS 3
     #endif
 
+    //
+    // Bicubic (Catmull-Rom) interpolation of the grid, at any resolution.
+    // As smooth as ABL_BILINEAR_SUBDIVISION without the subdivided grid,
+    // keeping only three slopes per probe point.
+    //
+    //#define ABL_BICUBIC_INTERPOLATION
+
   #endif
 
 #elif ENABLED(AUTO_BED_LEVELING_UBL)
@@ -50,6 +50,22 @@
  */
 #define THERMOCOUPLE_MAX_ERRORS 15
 
+/**
+ * Thermistor Direct Lookup
+ *
+ * Convert thermistor readings in constant time. The raw ADC range is split
+ * into buckets and each bucket starts the table scan at the right segment,
+ * instead of searching the whole table. Table results are unchanged.
+ * Custom (1000) thermistors interpolate a temperature table that is rebuilt
+ * whenever their parameters change (M305 / EEPROM), so they stay within a
+ * fraction of a degree below 300°C with the default 256 buckets.
+ * Requires C++14.
+ */
+//#define THERMISTOR_DIRECT_LOOKUP
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+  #define THERMISTOR_LOOKUP_BUCKETS 256   // Table entries per sensor. Uses 1 byte (2 bytes for 1000) of RAM or flash each.
+#endif
+
 //
 // Custom Thermistor 1000 parameters
 //
@@ -963,6 +979,17 @@
 // if unwanted behavior is observed on a user's machine when running at very slow speeds.
 #define MINIMUM_PLANNER_SPEED 0.05 // (mm/s)
 
+/**
+ * Fixed-point planner
+ * Run the lookahead and trapezoid math in integers instead of floats. Saves a lot of
+ * time per block on boards without an FPU. Speeds squared are kept in 24.8 fixed point
+ * and ratios in 16.16, so rates may differ from the float planner by a fraction of a step/s.
+ */
+//#define PLANNER_FIXED_POINT
+#if ENABLED(PLANNER_FIXED_POINT)
+  //#define PLANNER_FIXED_POINT_CHECK // Compare every trapezoid with the float result and report the largest error
+#endif
+
 //
 // Backlash Compensation
 // Adds extra movement to axes on direction-changes to account for backlash.
@@ -1063,6 +1090,50 @@
  */
 //#define ADAPTIVE_STEP_SMOOTHING
 
+/**
+ * Step Schedule
+ * Compute the step timing ahead of time, outside of the Stepper ISR. The Temperature ISR
+ * traces the planner blocks into a ring of timed step events (timer ticks + axis masks),
+ * spreading multi-step bursts evenly over each interval. The Stepper ISR only pops the due
+ * events and pulses the pins, so it spends very little time per step.
+ * Requires a 32-bit MCU. Not compatible with LIN_ADVANCE, DIRECT_STEPPING, INTEGRATED_BABYSTEPPING,
+ * LASER_POWER_INLINE, Z_LATE_ENABLE, I2S_STEPPER_STREAM, L64XX drivers or multiple extruders.
+ */
+//#define STEP_SCHEDULE
+#if ENABLED(STEP_SCHEDULE)
+  #define STEP_SCHEDULE_SIZE 256  // Step events in the ring. Must cover over 1ms of the fastest moves. (>= 256)
+#endif
+
+/**
+ * Input Shaping
+ * Cancel the ringing of the X and Y axes at their resonant frequency. Each step of a shaped
+ * axis is split into two or three impulses, and the later impulses are echoed by the Stepper ISR
+ * up to one period of the resonance after the step. This allows much higher acceleration
+ * without ghosting. Print a ringing tower to measure the frequency, then tune it with M593.
+ *   0 = ZV  : 2 impulses over half a period. Shortest delay, but sensitive to frequency errors.
+ *   1 = ZVD : 3 impulses over a full period. Tolerates frequency errors of about ±20%.
+ *   2 = EI  : 3 impulses over a full period. Allows 5% vibration to tolerate errors of about ±30%.
+ * Requires a 32-bit MCU and Cartesian kinematics. Not compatible with STEP_SCHEDULE,
+ * I2S_STEPPER_STREAM or BABYSTEP_XY.
+ */
+//#define INPUT_SHAPING_X
+//#define INPUT_SHAPING_Y
+#if EITHER(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+  #if ENABLED(INPUT_SHAPING_X)
+    #define SHAPING_FREQ_X  40    // (Hz) Resonant frequency of the X axis. 0 to disable.
+    #define SHAPING_ZETA_X  0.1   // Damping ratio of the X axis (0.0 - 0.99)
+    #define SHAPING_TYPE_X  0     // 0:ZV 1:ZVD 2:EI
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    #define SHAPING_FREQ_Y  40    // (Hz) Resonant frequency of the Y axis. 0 to disable.
+    #define SHAPING_ZETA_Y  0.1   // Damping ratio of the Y axis (0.0 - 0.99)
+    #define SHAPING_TYPE_Y  0     // 0:ZV 1:ZVD 2:EI
+  #endif
+  #define SHAPING_MIN_FREQ    20  // (Hz) Lowest frequency accepted by M593
+  #define SHAPING_BUFFER_SIZE 1024 // Stepper ISRs held for the echoes. Cover the longest delay at the fastest
+                                  // step rate: one period of SHAPING_MIN_FREQ (half for ZV) x Stepper ISR rate.
+#endif
+
 /**
  * Custom Microstepping
  * Override as-needed for your setup. Up to 3 MS pins are supported.
@@ -1289,6 +1360,14 @@
 
   #define SD_PROCEDURE_DEPTH 1              // Increase if you need more nested M32 calls
 
+  /**
+   * Read the file being printed ahead in bursts of whole 512-byte sectors
+   * and split lines straight out of RAM, instead of going through the FAT
+   * code for every byte. Helps keep the planner fed on fast prints with many
+   * short segments. Uses 512 bytes of SRAM per sector.
+   */
+  #define SD_READ_AHEAD_SECTORS 2
+
   #define SD_FINISHED_STEPPERRELEASE true   // Disable steppers when SD Print is finished
   #define SD_FINISHED_RELEASECOMMAND "M84"  // Use "M84XYE" to keep Z enabled so your bed stays in place
 
@@ -1906,6 +1985,16 @@
 
 #if BOTH(AUTO_BED_LEVELING_UBL, EEPROM_SETTINGS)
   //#define OPTIMIZED_MESH_STORAGE  // Store mesh with less precision to save EEPROM space
+
+  /**
+   * Store each mesh slot as a fitted plane plus packed residuals with a CRC.
+   * Residuals are kept to 1µm, coarsened by powers of 2 only if the mesh
+   * doesn't fit in MESH_STORE_BYTES. Fits many more slots than raw floats.
+   */
+  //#define COMPRESSED_MESH_STORAGE
+  #if ENABLED(COMPRESSED_MESH_STORAGE)
+    #define MESH_STORE_BYTES ((GRID_MAX_POINTS_X) * (GRID_MAX_POINTS_Y) + 16) // Residual bytes per slot
+  #endif
 #endif
 
 /**
@@ -1926,6 +2015,19 @@
 
 #endif
 
+/**
+ * Flying Probe
+ * Probe the G29 grid without a full raise and two-speed descent at every point.
+ * After the first point the probe only lifts FLYING_PROBE_CLEARANCE above the
+ * last trigger height. The lift, the travel to the next point and the slow
+ * descent are queued together so the planner can blend them without stopping.
+ * The bed must not rise more than FLYING_PROBE_CLEARANCE between neighboring points.
+ */
+//#define FLYING_PROBE
+#if ENABLED(FLYING_PROBE)
+  #define FLYING_PROBE_CLEARANCE 2  // (mm) Lift above the last trigger point before moving to the next
+#endif
+
 /**
  * Thermal Probe Compensation
  * Probe measurements are adjusted to compensate for temperature distortion.
@@ -2002,11 +2104,51 @@
   //#define ARC_P_CIRCLES           // Enable the 'P' parameter to specify complete circles
   //#define CNC_WORKSPACE_PLANES    // Allow G2/G3 to operate in XY, ZX, or YZ planes
   //#define SF_ARC_FIX              // Enable only if using SkeinForge with "Arc Point" fillet procedure
+  //#define NATIVE_ARC_BLOCKS       // Plan each arc as one block, traced by the Stepper ISR. Requires a 32-bit MCU.
 #endif
 
 // Support for G5 with XYZE destination and IJPQ offsets. Requires ~2666 bytes.
 //#define BEZIER_CURVE_SUPPORT
 
+/**
+ * Chordal Tolerance
+ *
+ * Size G2/G3 arc and G5 curve segments so no segment strays further than
+ * this from the true curve. Wide curves get long segments and tight ones
+ * stay accurate. When the planner is running dry segments are lengthened
+ * to last as long as the planner takes to buffer one.
+ * Overrides MM_PER_ARC_SEGMENT, ARC_SEGMENTS_PER_R and ARC_SEGMENTS_PER_SEC.
+ * Set with M214 S<mm>.
+ */
+//#define CHORDAL_TOLERANCE 0.01 // (mm)
+
+/**
+ * Incremental Delta Kinematics
+ *
+ * Step the tower positions along each segmented straight line instead of
+ * solving the full inverse kinematics (three square roots) per segment.
+ * Boards without an FPU (e.g., LPC176x) can then afford a higher
+ * DELTA_SEGMENTS_PER_SECOND. The error stays around a micron.
+ */
+//#define DELTA_INCREMENTAL_IK
+#if ENABLED(DELTA_INCREMENTAL_IK)
+  //#define DELTA_INCREMENTAL_IK_CHECK // Compare every segment with the exact solution and report the largest error
+#endif
+
+/**
+ * Stepper Leveling
+ *
+ * Instead of splitting leveled moves into a block per mesh cell (or per
+ * LEVELED_SEGMENT_LENGTH) let each block carry the Z correction at the grid
+ * lines it crosses. The Stepper ISR follows the corrected Z piece by piece,
+ * so a long leveled move stays a single block.
+ * For Cartesian machines with MESH_BED_LEVELING or AUTO_BED_LEVELING_BILINEAR.
+ */
+//#define STEPPER_LEVELING
+#if ENABLED(STEPPER_LEVELING)
+  #define LEVELING_BLOCK_PIECES 8   // Grid cells a block may span before the move is split (2-32)
+#endif
+
 /**
  * Direct Stepping
  *
@@ -2014,6 +2156,10 @@
  * reduces motion calculations, increases top printing speeds, and results in
  * less step aliasing by calculating all motions in advance.
  * Preparing your G-code: https://github.com/colinrgodsey/step-daemon
+ *
+ * Page frames are also read from SD files, so a compiled print needs no host.
+ * The LINUX simulator compiles G-code for this configuration with:
+ *   program --compile-pages=out.gcode [--page-rate=20000] < in.gcode
  */
 //#define DIRECT_STEPPING
 
@@ -2088,7 +2234,8 @@
 // @section motion
 
 // The number of linear moves that can be in the planner at once.
-// The value of BLOCK_BUFFER_SIZE must be a power of 2 (e.g. 8, 16, 32)
+// Powers of 2 (e.g. 8, 16, 32) are slightly faster. Boards with 32-bit
+// CPUs and plenty of RAM may use up to 512 for a longer lookahead.
 #if BOTH(SDSUPPORT, DIRECT_STEPPING)
   #define BLOCK_BUFFER_SIZE  8
 #elif ENABLED(SDSUPPORT)
@@ -2179,6 +2326,40 @@
 // Some clients will have this feature soon. This could make the NO_TIMEOUTS unnecessary.
 //#define ADVANCED_OK
 
+/**
+ * Windowed Host Streaming (M576 S1)
+ *
+ * A host that sees "Cap:STREAM_WINDOW:1" in M115 may send "M576 S1" and then
+ * stream numbered, checksummed lines without waiting for each "ok". Instead of
+ * one "ok" per line Marlin sends "ok N<done> R<read>" after every STREAM_ACK_LINES
+ * lines and whenever the queue runs dry. The host may send line n while
+ * n <= N + STREAM_WINDOW_LINES and the lines it sent after line R fit in
+ * STREAM_WINDOW_BYTES. Errors still answer "Resend:" and the lines sent after
+ * the bad one are dropped quietly until the requested line arrives.
+ * See buildroot/share/scripts/host_stream.py
+ */
+//#define STREAM_WINDOW
+#if ENABLED(STREAM_WINDOW)
+  #define STREAM_WINDOW_LINES   32  // Lines the host may send beyond the last one done
+  #define STREAM_WINDOW_BYTES 1024  // Bytes the host may send beyond the last line read. Keep within RX_BUFFER_SIZE without flow control.
+  #define STREAM_ACK_LINES       8  // Lines done between credit reports
+#endif
+
+/**
+ * Binary G-code Streaming (M576 S2)
+ *
+ * After "M576 S2" the host sends G-code in the checksummed packets of the
+ * binary file transfer protocol instead of numbered lines. Packets may be
+ * heatshrink compressed (window 8, lookahead 4) as one continuous stream and
+ * a corrupt packet is simply sent again. Each packet is acknowledged once all
+ * of its lines are in the command queue. A CLOSE packet returns to text mode.
+ * See buildroot/share/scripts/host_stream.py
+ */
+//#define BINARY_GCODE_STREAM
+#if ENABLED(BINARY_GCODE_STREAM)
+  #define BINARY_STREAM_PACKET_SIZE 512 // Largest packet payload in bytes
+#endif
+
 // Printrun may have trouble receiving long strings all at once.
 // This option inserts short delays between lines of serial output.
 #define SERIAL_OVERRUN_PROTECTION
@@ -3505,6 +3686,7 @@
 
 #if ENABLED(FASTER_GCODE_PARSER)
   #define GCODE_QUOTED_STRINGS  // Support for quoted string parameters
+  //#define BINARY_GCODE_COMMANDS // Accept pre-tokenized binary commands from serial and SD. See buildroot/share/scripts/gcode_binary.py
 #endif
 
 // Support for MeatPack G-code compression (https://github.com/scottmudge/OctoPrint-MeatPack)
@@ -376,24 +376,9 @@ int MarlinSerial<Cfg>::peek() {
   return h == t ? -1 : rx_buffer.buffer[t];
 }
 
+// Ask for the host to resume if XOFF was sent and the RX buffer has drained
 template<typename Cfg>
-int MarlinSerial<Cfg>::read() {
-  const ring_buffer_pos_t h = atomic_read_rx_head();
-
-  // Read the tail. Main thread owns it, so it is safe to directly read it
-  ring_buffer_pos_t t = rx_buffer.tail;
-
-  // If nothing to read, return now
-  if (h == t) return -1;
-
-  // Get the next char
-  const int v = rx_buffer.buffer[t];
-  t = (ring_buffer_pos_t)(t + 1) & (Cfg::RX_SIZE - 1);
-
-  // Advance tail - Making sure the RX ISR will always get an stable value, even
-  // if it interrupts the writing of the value of that variable in the middle.
-  atomic_set_rx_tail(t);
-
+FORCE_INLINE void MarlinSerial<Cfg>::xon_if_drained(const ring_buffer_pos_t h, const ring_buffer_pos_t t) {
   if (Cfg::XONOFF) {
     // If the XOFF char was sent, or about to be sent...
     if ((xon_xoff_state & XON_XOFF_CHAR_MASK) == XOFF_CHAR) {
@@ -415,10 +400,47 @@ int MarlinSerial<Cfg>::read() {
       }
     }
   }
+}
+
+template<typename Cfg>
+int MarlinSerial<Cfg>::read() {
+  const ring_buffer_pos_t h = atomic_read_rx_head();
+
+  // Read the tail. Main thread owns it, so it is safe to directly read it
+  ring_buffer_pos_t t = rx_buffer.tail;
+
+  // If nothing to read, return now
+  if (h == t) return -1;
+
+  // Get the next char
+  const int v = rx_buffer.buffer[t];
+  t = (ring_buffer_pos_t)(t + 1) & (Cfg::RX_SIZE - 1);
+
+  // Advance tail - Making sure the RX ISR will always get an stable value, even
+  // if it interrupts the writing of the value of that variable in the middle.
+  atomic_set_rx_tail(t);
+
+  xon_if_drained(h, t);
 
   return v;
 }
 
+template<typename Cfg>
+uint16_t MarlinSerial<Cfg>::rxSpan(const uint8_t **data) {
+  // The RX ISR only writes ahead of the head, so the bytes from the tail stay put until consumed
+  const ring_buffer_pos_t h = atomic_read_rx_head(), t = rx_buffer.tail;
+  *data = &rx_buffer.buffer[t];
+  return h >= t ? h - t : Cfg::RX_SIZE - t;
+}
+
+template<typename Cfg>
+void MarlinSerial<Cfg>::rxConsume(const uint16_t count) {
+  const ring_buffer_pos_t h = atomic_read_rx_head(),
+                          t = (ring_buffer_pos_t)(rx_buffer.tail + count) & (Cfg::RX_SIZE - 1);
+  atomic_set_rx_tail(t);
+  xon_if_drained(h, t);
+}
+
 template<typename Cfg>
 typename MarlinSerial<Cfg>::ring_buffer_pos_t MarlinSerial<Cfg>::available() {
   const ring_buffer_pos_t h = atomic_read_rx_head(), t = rx_buffer.tail;
@@ -199,6 +199,8 @@
     static FORCE_INLINE void atomic_set_rx_tail(ring_buffer_pos_t value);
     static FORCE_INLINE ring_buffer_pos_t atomic_read_rx_tail();
 
+    static FORCE_INLINE void xon_if_drained(const ring_buffer_pos_t h, const ring_buffer_pos_t t);
+
   public:
     FORCE_INLINE static void store_rxd_char();
     FORCE_INLINE static void _tx_udr_empty_irq();
@@ -208,6 +210,8 @@
     static void end();
     static int peek();
     static int read();
+    static uint16_t rxSpan(const uint8_t **data);   // Received bytes in place, up to the wrap
+    static void rxConsume(const uint16_t count);    // Drop bytes taken from the span
     static void flush();
     static ring_buffer_pos_t available();
     static void write(const uint8_t c);
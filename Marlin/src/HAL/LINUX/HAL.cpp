@@ -23,6 +23,7 @@
 
 #include "../../inc/MarlinConfig.h"
 #include "../shared/Delay.h"
+#include "hardware/Kernel.h"
 
 MSerialT usb_serial(TERN0(EMERGENCY_PARSER, true));
 
@@ -75,4 +76,9 @@ void HAL_pwm_init() {
 
 void HAL_reboot() { /* Reset the application state and GPIO */ }
 
+// In virtual time the main thread drives the simulation whenever Marlin is idle
+void HAL_idletask() {
+  if (Clock::isVirtual()) Kernel::yield();
+}
+
 #endif // __PLAT_LINUX__
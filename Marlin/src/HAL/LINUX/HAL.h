@@ -50,6 +50,7 @@ uint8_t _getc();
 #define B10 2
 
 #include "hardware/Clock.h"
+#include "hardware/Benchmark.h"
 
 #include "../shared/Marduino.h"
 #include "../shared/math_32bit.h"
@@ -67,6 +68,9 @@ extern MSerialT usb_serial;
 #define ST7920_DELAY_2 DELAY_NS(750)
 #define ST7920_DELAY_3 DELAY_NS(750)
 
+// Time each planner lookahead for the --benchmark report
+#define HAL_PLANNER_PROFILE(CODE) Benchmark::lookahead([]{ CODE; })
+
 //
 // Interrupts
 //
@@ -78,6 +82,9 @@ extern MSerialT usb_serial;
 
 inline void HAL_init() {}
 
+#define HAL_IDLETASK 1
+void HAL_idletask();
+
 // Utility functions
 #if GCC_VERSION <= 50000
   #pragma GCC diagnostic push
@@ -24,6 +24,7 @@
 #include <iostream>
 #include "../../inc/MarlinConfig.h"
 #include "hardware/Clock.h"
+#include "hardware/Kernel.h"
 #include "../shared/Delay.h"
 
 // Interrupts
@@ -36,9 +37,15 @@ void _delay_ms(const int delay_ms) {
 }
 
 uint32_t millis() {
+  if (Clock::isVirtual()) Kernel::spin();
   return (uint32_t)Clock::millis();
 }
 
+uint32_t micros() {
+  if (Clock::isVirtual()) Kernel::spin();
+  return (uint32_t)Clock::micros();
+}
+
 // This is required for some Arduino libraries we are using
 void delayMicroseconds(uint32_t us) {
   Clock::delayMicros(us);
@@ -0,0 +1,198 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../../inc/MarlinConfig.h"
+#include "../../../module/planner.h"
+#include "../../../module/stepper.h"
+#include "Benchmark.h"
+#include "Clock.h"
+#include "Kernel.h"
+
+#include <math.h>
+#include <string.h>
+
+bool Benchmark::enabled = false, Benchmark::input_done = false, Benchmark::starving = false;
+Benchmark::Histogram Benchmark::isr[Benchmark::max_timers], Benchmark::planner_lookahead;
+uint64_t Benchmark::main_ns = 0, Benchmark::blocks = 0, Benchmark::starvations = 0,
+         Benchmark::starved_ns = 0, Benchmark::starve_start = 0, Benchmark::ring_errors = 0;
+uint16_t Benchmark::last_tail = 0;
+Benchmark::MotionSample Benchmark::motion[2 * Benchmark::motion_span + 1];
+uint8_t Benchmark::motion_count = 0;
+uint64_t Benchmark::next_motion_ns = 0, Benchmark::accel_count = 0, Benchmark::accel_hist[Benchmark::accel_bins + 1];
+double Benchmark::accel_max = 0;
+
+static const char* const timer_names[] = { "Stepper", "Temperature", "Timer 2", "Timer 3" };
+
+void Benchmark::Histogram::add(uint64_t ns) {
+  count++;
+  total_ns += ns;
+  if (ns > max_ns) max_ns = ns;
+  uint8_t b = 0;
+  while (b < buckets - 1 && (1ULL << (b + 1)) <= ns) b++;
+  bucket[b]++;
+}
+
+uint64_t Benchmark::Histogram::percentile(double p) const {
+  const uint64_t target = uint64_t(p * count);
+  uint64_t seen = 0;
+  for (uint8_t b = 0; b < buckets; b++) {
+    seen += bucket[b];
+    if (seen > target) return _MIN(2ULL << b, max_ns);
+  }
+  return max_ns;
+}
+
+void Benchmark::interrupt(uint8_t timer, uint64_t host_ns) {
+  if (!enabled || timer >= max_timers) return;
+  isr[timer].add(host_ns);
+  if (timer == STEP_TIMER_NUM) {
+    samplePlanner();
+    sampleMotion();
+  }
+}
+
+// Interrupts only run when the main thread yields, so this is the planner alone
+void Benchmark::lookahead(lookahead_fn* fn) {
+  if (!enabled) return fn();
+  const uint64_t start = Kernel::hostNanos();
+  fn();
+  planner_lookahead.add(Kernel::hostNanos() - start);
+}
+
+/**
+ * Count the blocks the stepper has finished since the last sample, and
+ * note when the planner runs dry before the input has been exhausted.
+ *
+ * Also check the block ring indices are still in order. The ISR moves
+ * tail, nonbusy and planned, the main thread moves head, and every reader
+ * relies on tail <= nonbusy, planned <= head (in ring order).
+ */
+void Benchmark::samplePlanner() {
+  const block_index_t tail = planner.block_buffer_tail, head = planner.block_buffer_head,
+                      queued = block_ring_t::distance(tail, head);
+  if (block_ring_t::distance(tail, planner.block_buffer_nonbusy) > queued
+   || block_ring_t::distance(tail, planner.block_buffer_planned) > queued
+  ) ring_errors++;
+
+  blocks += block_ring_t::distance(last_tail, tail);
+  last_tail = tail;
+
+  const bool empty = !planner.has_blocks_queued();
+  if (starving) {
+    if (!empty) {
+      starving = false;
+      starved_ns += Clock::nanos() - starve_start;
+    }
+  }
+  else if (empty && blocks && !input_done) {
+    starving = true;
+    starvations++;
+    starve_start = Clock::nanos();
+  }
+}
+
+/**
+ * Estimate the head acceleration from second differences of the XY position
+ * across motion_span samples. Samples land on the first stepper interrupt
+ * past each period, so the differences use the actual sample times.
+ */
+void Benchmark::sampleMotion() {
+  const uint64_t now = Clock::nanos();
+  if (now < next_motion_ns) return;
+  next_motion_ns = now + motion_sample_ns;
+
+  // Only measure while moving, so idle gaps don't count as motion
+  if (!planner.has_blocks_queued()) { motion_count = 0; return; }
+
+  constexpr uint8_t window = COUNT(motion);
+  memmove(&motion[0], &motion[1], sizeof(motion) - sizeof(motion[0]));
+  motion[window - 1] = { now, stepper.position(X_AXIS) / double(planner.settings.axis_steps_per_mm[X_AXIS]),
+                              stepper.position(Y_AXIS) / double(planner.settings.axis_steps_per_mm[Y_AXIS]) };
+  if (motion_count < window) { motion_count++; return; }
+
+  const MotionSample &p0 = motion[0], &p1 = motion[motion_span], &p2 = motion[window - 1];
+  const double t01 = (p1.ns - p0.ns) * 1e-9, t12 = (p2.ns - p1.ns) * 1e-9, t02 = (p2.ns - p0.ns) * 1e-9,
+               ax = 2 * ((p2.x - p1.x) / t12 - (p1.x - p0.x) / t01) / t02,
+               ay = 2 * ((p2.y - p1.y) / t12 - (p1.y - p0.y) / t01) / t02,
+               a = sqrt(ax * ax + ay * ay);
+  accel_hist[_MIN(uint32_t(a / accel_bin), uint32_t(accel_bins))]++;
+  accel_count++;
+  if (a > accel_max) accel_max = a;
+}
+
+void Benchmark::report(FILE* out) {
+  if (!enabled) return;
+  if (starving) starved_ns += Clock::nanos() - starve_start;
+
+  const double sim_s = Clock::seconds(), main_s = main_ns * 1e-9;
+  fprintf(out, "Blocks: %llu (%.1f/s simulated, %.1f/s of main thread CPU)\n",
+    (unsigned long long)blocks, sim_s > 0 ? blocks / sim_s : 0.0, main_s > 0 ? blocks / main_s : 0.0);
+  fprintf(out, "Main thread: %.3fs host\n", main_s);
+  fprintf(out, "Starvations: %llu (%.3fs starved)\n", (unsigned long long)starvations, starved_ns * 1e-9);
+  fprintf(out, "Block ring: %u blocks, %llu index order errors\n", unsigned(BLOCK_BUFFER_SIZE), (unsigned long long)ring_errors);
+  #if ENABLED(STEP_SCHEDULE)
+    fprintf(out, "Step schedule: %u events, %lu underruns\n", unsigned(STEP_SCHEDULE_SIZE), (unsigned long)stepper.schedule_underruns);
+  #endif
+
+  for (uint8_t t = 0; t < max_timers; t++) {
+    char name[24];
+    snprintf(name, sizeof(name), "%s ISR", timer_names[t]);
+    print(out, name, isr[t]);
+  }
+  print(out, "Planner lookahead", planner_lookahead);
+
+  if (accel_count) {
+    auto accel_percentile = [](const double p) {
+      const uint64_t target = uint64_t(p * accel_count);
+      uint64_t seen = 0;
+      for (uint16_t b = 0; b <= accel_bins; b++)
+        if ((seen += accel_hist[b]) > target) return unsigned((b + 1) * accel_bin);
+      return unsigned(accel_bins * accel_bin);
+    };
+    const uint16_t over_bin = planner.settings.acceleration * 1.1f / accel_bin;
+    uint64_t over = 0;
+    for (uint16_t b = over_bin; b <= accel_bins; b++) over += accel_hist[b];
+    fprintf(out, "Head acceleration: %llu samples, p50 %umm/s2, p99 %umm/s2, max %.0fmm/s2, %.2f%% over 110%% of M204 P\n",
+      (unsigned long long)accel_count, accel_percentile(0.5), accel_percentile(0.99), accel_max, 100.0 * over / accel_count);
+  }
+}
+
+void Benchmark::print(FILE* out, const char* name, const Histogram &h) {
+  if (!h.count) return;
+  fprintf(out, "%s: %llu calls, mean %lluns, p50 %lluns, p99 %lluns, p99.9 %lluns, max %lluns\n",
+    name, (unsigned long long)h.count, (unsigned long long)(h.total_ns / h.count),
+    (unsigned long long)h.percentile(0.5), (unsigned long long)h.percentile(0.99),
+    (unsigned long long)h.percentile(0.999), (unsigned long long)h.max_ns);
+  uint64_t peak = 0;
+  for (uint8_t b = 0; b < buckets; b++) peak = _MAX(peak, h.bucket[b]);
+  for (uint8_t b = 0; b < buckets; b++) {
+    if (!h.bucket[b]) continue;
+    char bar[41];
+    const uint8_t len = _MAX(1, int(40 * h.bucket[b] / peak));
+    memset(bar, '#', len);
+    bar[len] = '\0';
+    fprintf(out, "  %10lluns %10llu %s\n", (unsigned long long)(1ULL << b), (unsigned long long)h.bucket[b], bar);
+  }
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,85 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+/**
+ * Throughput and latency statistics for the virtual-time simulator.
+ *
+ * The Kernel reports the host time spent in each timer interrupt and in the
+ * main thread between yields. Planner progress is sampled after every stepper
+ * interrupt, so the report shows how many blocks the main thread can plan per
+ * second of host CPU, how often the planner ran dry while input was still
+ * pending, and the latency distribution of each interrupt handler.
+ * The planner's lookahead (recalculate) is timed on its own, once per block,
+ * and the block ring's head/tail order is checked at every stepper interrupt.
+ * The XY stepper positions are sampled too, giving the distribution of the
+ * head acceleration actually produced (Cartesian machines), to check that
+ * motion changes stay within the configured acceleration.
+ */
+class Benchmark {
+public:
+  static constexpr uint8_t max_timers = 4;
+  static constexpr uint8_t buckets = 32;     // log2(ns) buckets, 1ns .. ~4s
+
+  struct Histogram {
+    uint64_t count, total_ns, max_ns;
+    uint64_t bucket[buckets];
+    void add(uint64_t ns);
+    uint64_t percentile(double p) const;     // Upper bound of the bucket holding p
+  };
+
+  static void enable() { enabled = true; }
+  static bool isEnabled() { return enabled; }
+
+  static void interrupt(uint8_t timer, uint64_t host_ns);
+  static void mainThread(uint64_t host_ns) { main_ns += host_ns; }
+  static void inputDone() { input_done = true; }
+
+  typedef void (lookahead_fn)();
+  static void lookahead(lookahead_fn* fn);
+
+  static void report(FILE* out);
+
+private:
+  static constexpr uint64_t motion_sample_ns = 2000000; // Sample XY every 2ms
+  static constexpr uint8_t motion_span = 5;             // Differentiate over 10ms to smooth out the steps
+  static constexpr uint16_t accel_bin = 50,             // mm/s² per histogram bin
+                            accel_bins = 400;
+
+  static void samplePlanner();
+  static void sampleMotion();
+  static void print(FILE* out, const char* name, const Histogram &h);
+
+  static bool enabled, input_done, starving;
+  static Histogram isr[max_timers], planner_lookahead;
+  static uint64_t main_ns, blocks, starvations, starved_ns, starve_start, ring_errors;
+  static uint16_t last_tail;
+
+  struct MotionSample { uint64_t ns; double x, y; };
+  static MotionSample motion[2 * motion_span + 1];
+  static uint8_t motion_count;
+  static uint64_t next_motion_ns, accel_count, accel_hist[accel_bins + 1];
+  static double accel_max;
+};
@@ -23,9 +23,19 @@
 
 #include "../../../inc/MarlinConfig.h"
 #include "Clock.h"
+#include "Kernel.h"
 
 std::chrono::nanoseconds Clock::startup = std::chrono::high_resolution_clock::now().time_since_epoch();
 uint32_t Clock::frequency = F_CPU;
 double Clock::time_multiplier = 1.0;
+bool Clock::virtual_time = false;
+uint64_t Clock::virtual_nanos = 0;
+
+void Clock::delayNanos(uint64_t ns) {
+  if (Clock::virtual_time)
+    Kernel::delayNanos(ns);
+  else
+    std::this_thread::sleep_for(std::chrono::nanoseconds(ns) / Clock::time_multiplier);
+}
 
 #endif // __PLAT_LINUX__
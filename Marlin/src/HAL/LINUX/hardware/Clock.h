@@ -27,7 +27,7 @@
 class Clock {
 public:
   static uint64_t ticks(uint32_t frequency = Clock::frequency) {
-    return (Clock::nanos() - Clock::startup.count()) / (1000000000ULL / frequency);
+    return Clock::nanos() / (1000000000ULL / frequency);
   }
 
   static uint64_t nanosToTicks(uint64_t ns, uint32_t frequency = Clock::frequency) {
@@ -45,6 +45,7 @@ public:
 
   // Time Acceleration compensated
   static uint64_t nanos() {
+    if (Clock::virtual_time) return Clock::virtual_nanos;
     auto now = std::chrono::high_resolution_clock::now().time_since_epoch();
     return (now.count() - Clock::startup.count()) * Clock::time_multiplier;
   }
@@ -61,20 +62,23 @@ public:
     return Clock::nanos() / 1000000000.0;
   }
 
+  // Sleep in real time, or let the Kernel run events up to the deadline in virtual time
+  static void delayNanos(uint64_t ns);
+
   static void delayCycles(uint64_t cycles) {
-    std::this_thread::sleep_for(std::chrono::nanoseconds( (1000000000L / frequency) * cycles) / Clock::time_multiplier );
+    Clock::delayNanos((1000000000ULL / frequency) * cycles);
   }
 
   static void delayMicros(uint64_t micros) {
-    std::this_thread::sleep_for(std::chrono::microseconds( micros ) / Clock::time_multiplier);
+    Clock::delayNanos(micros * 1000);
   }
 
   static void delayMillis(uint64_t millis) {
-    std::this_thread::sleep_for(std::chrono::milliseconds( millis ) / Clock::time_multiplier);
+    Clock::delayNanos(millis * 1000000);
   }
 
   static void delaySeconds(double secs) {
-    std::this_thread::sleep_for(std::chrono::duration<double, std::milli>(secs * 1000) / Clock::time_multiplier);
+    Clock::delayNanos(secs * 1000000000.0);
   }
 
   // Will reduce timer resolution increasing likelihood of overflows
@@ -82,8 +86,25 @@ public:
     Clock::time_multiplier = tm;
   }
 
+  // Virtual time starts at zero and only moves when the Kernel advances it
+  static void setVirtual(bool enable) {
+    Clock::virtual_time = enable;
+    Clock::virtual_nanos = 0;
+  }
+
+  static bool isVirtual() {
+    return Clock::virtual_time;
+  }
+
+  // Virtual time never runs backwards
+  static void advanceTo(uint64_t ns) {
+    if (ns > Clock::virtual_nanos) Clock::virtual_nanos = ns;
+  }
+
 private:
   static std::chrono::nanoseconds startup;
   static uint32_t frequency;
   static double time_multiplier;
+  static bool virtual_time;
+  static uint64_t virtual_nanos;
 };
@@ -0,0 +1,145 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "Kernel.h"
+#include "Benchmark.h"
+
+#include <chrono>
+
+Timer* Kernel::timers[Kernel::max_timers];
+Kernel::task_fn* Kernel::tasks[Kernel::max_tasks];
+uint8_t Kernel::timer_count = 0, Kernel::task_count = 0;
+bool Kernel::dispatching = false;
+bool Kernel::profiling = false;
+double Kernel::cpu_scale = 0;
+uint64_t Kernel::resumed = 0;
+
+uint64_t Kernel::hostNanos() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void Kernel::setProfiling(bool enable, double scale) {
+  profiling = enable || scale > 0;
+  cpu_scale = scale;
+  resumed = hostNanos();
+}
+
+/**
+ * Account for the host time the main thread spent since it last left the Kernel.
+ * With a CPU scale that time also passes on the virtual clock, during which
+ * due interrupts preempt it just as they would on the real board.
+ */
+void Kernel::enter() {
+  if (!profiling) return;
+  const uint64_t spent = hostNanos() - resumed;
+  Benchmark::mainThread(spent);
+  if (cpu_scale > 0) {
+    const uint64_t until = Clock::nanos() + uint64_t(spent * cpu_scale);
+    while (runNextEvent(until)) { /* nada */ }
+    Clock::advanceTo(until);
+  }
+}
+
+void Kernel::leave() {
+  if (profiling) resumed = hostNanos();
+}
+
+void Kernel::attachTimer(Timer* timer) {
+  if (timer_count < max_timers) timers[timer_count++] = timer;
+}
+
+void Kernel::attachTask(task_fn* fn) {
+  if (task_count < max_tasks) tasks[task_count++] = fn;
+}
+
+/**
+ * Fire the earliest enabled timer that is due no later than 'limit'.
+ * Return false if there is no such timer.
+ */
+bool Kernel::runNextEvent(uint64_t limit) {
+  Timer* next = nullptr;
+  uint8_t index = 0;
+  for (uint8_t i = 0; i < timer_count; i++) {
+    Timer* t = timers[i];
+    if (t->enabled() && t->armed() && t->nextFire() <= limit && (!next || t->nextFire() < next->nextFire())) {
+      next = t;
+      index = i;
+    }
+  }
+  if (!next) return false;
+
+  Clock::advanceTo(next->nextFire());
+  dispatching = true;
+  if (profiling) {
+    const uint64_t start = hostNanos();
+    next->fire();
+    const uint64_t spent = hostNanos() - start;
+    Benchmark::interrupt(index, spent);
+    if (cpu_scale > 0) Clock::advanceTo(Clock::nanos() + uint64_t(spent * cpu_scale));
+  }
+  else
+    next->fire();
+  dispatching = false;
+  return true;
+}
+
+void Kernel::runTasks() {
+  dispatching = true;
+  for (uint8_t i = 0; i < task_count; i++) tasks[i]();
+  dispatching = false;
+}
+
+void Kernel::yield() {
+  if (dispatching) return;
+  enter();
+  runTasks();
+  if (!runNextEvent(UINT64_MAX))
+    Clock::advanceTo(Clock::nanos() + idle_ns);
+  leave();
+}
+
+void Kernel::spin(uint64_t ns) {
+  if (dispatching) {
+    Clock::advanceTo(Clock::nanos() + ns);
+    return;
+  }
+  enter();
+  const uint64_t until = Clock::nanos() + ns;
+  while (runNextEvent(until)) { /* nada */ }
+  Clock::advanceTo(until);
+  leave();
+}
+
+void Kernel::delayNanos(uint64_t ns) {
+  if (dispatching) {
+    Clock::advanceTo(Clock::nanos() + ns);
+    return;
+  }
+  enter();
+  const uint64_t until = Clock::nanos() + ns;
+  do runTasks(); while (runNextEvent(until));
+  Clock::advanceTo(until);
+  leave();
+}
+
+#endif // __PLAT_LINUX__
@@ -0,0 +1,80 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "Clock.h"
+#include "Timer.h"
+
+/**
+ * Discrete-event scheduler for virtual time.
+ *
+ * With virtual time enabled nothing runs on its own: the timer "interrupts"
+ * and the simulation tasks only run when the main thread yields, delays or
+ * polls the clock. The Kernel then advances the virtual Clock straight to the
+ * next due event and runs it, all on one thread and in timestamp order (ties
+ * go to the timer attached first). Idle time costs nothing, so a long print
+ * replays much faster than real time, and it replays the same way every run.
+ */
+class Kernel {
+public:
+  typedef void (task_fn)();
+
+  static constexpr uint8_t max_timers = 4;
+  static constexpr uint8_t max_tasks = 4;
+
+  static constexpr uint64_t spin_ns = 1000;     // Virtual cost of polling millis()
+  static constexpr uint64_t idle_ns = 1000000;  // Time step when no timer is armed
+
+  static void attachTimer(Timer* timer);
+  static void attachTask(task_fn* fn);
+
+  // Run the tasks and the next due event, advancing time to it
+  static void yield();
+
+  // Charge a little time for a clock or counter read so polling loops,
+  // including the ones inside interrupt handlers, make progress
+  static void spin(uint64_t ns = spin_ns);
+
+  // Run all events up to now + ns. Inside an interrupt only the clock moves.
+  static void delayNanos(uint64_t ns);
+
+  // Measure host time spent in the main thread and in each timer handler.
+  // A non-zero cpu_scale also charges that time, scaled, to the virtual clock.
+  static void setProfiling(bool enable, double cpu_scale=0);
+
+  static uint64_t hostNanos();
+
+private:
+  static bool runNextEvent(uint64_t limit);
+  static void runTasks();
+  static void enter();
+  static void leave();
+
+  static Timer* timers[max_timers];
+  static task_fn* tasks[max_tasks];
+  static uint8_t timer_count, task_count;
+  static bool dispatching, profiling;
+  static double cpu_scale;
+  static uint64_t resumed;
+};
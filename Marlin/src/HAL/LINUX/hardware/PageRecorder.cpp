@@ -0,0 +1,293 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifdef __PLAT_LINUX__
+
+#include "../../../inc/MarlinConfig.h"
+
+#if ENABLED(DIRECT_STEPPING)
+
+#include "../../../feature/direct_stepping.h"
+#include "../../../gcode/queue.h"
+#include "../../../module/motion.h"
+#include "../../../module/planner.h"
+#include "PageRecorder.h"
+#include "Timer.h"
+
+#include <deque>
+#include <string>
+
+typedef DirectStepping::Config Cfg;
+
+FILE *PageRecorder::out = nullptr;
+uint32_t PageRecorder::rate;
+LinearAxis *PageRecorder::axes[4];
+
+// A command passed through as text, and the blocks it planned itself
+struct PassThrough {
+  uint32_t first, last;   // Block sequence range [first, last), last is UINT32_MAX until it has run
+  bool flush;             // End the page and re-sync before it, since it waited for the planner
+  std::string text;
+};
+
+enum FeedPhase : uint8_t { FEED_READY, FEED_WAIT_BEFORE, FEED_WAIT_AFTER };
+
+static std::deque<PassThrough> records;       // Waiting for their blocks to be reached
+static std::deque<PassThrough> skips;         // Block ranges to leave out of the pages
+static std::string page_text, line;           // Text to follow the current page, line being fed
+static FeedPhase phase = FEED_READY;
+static bool is_g92;
+
+static Timer sampler;
+static uint32_t queued, completed;            // Block sequence numbers
+static block_index_t last_head, last_tail;
+static int32_t last_steps[4], carry[4];
+static int8_t segments[Cfg::SEGMENTS][4], page_dir[4];
+static uint16_t segment_count;
+static uint8_t page_idx;
+static bool synced = true;                    // No pages since the last G6 re-sync
+static uint32_t pages, overflows;
+
+// Step count of an axis in the stepper's own direction
+static constexpr int8_t dir_sign[4] = {
+  INVERT_X_DIR ? -1 : 1, INVERT_Y_DIR ? -1 : 1, INVERT_Z_DIR ? -1 : 1, INVERT_E0_DIR ? -1 : 1
+};
+
+bool PageRecorder::begin(const char *path, const uint32_t page_rate) {
+  out = fopen(path, "wb");
+  if (!out) return false;
+  rate = page_rate;
+  // The Kernel fires the sampler at each segment boundary, after a stepper ISR due at the same time
+  sampler.init(2, 1000000000, tick);
+  sampler.setCompare(uint64_t(Cfg::SEGMENT_STEPS) * 1000000000ULL / rate);
+  sampler.enable();
+  return true;
+}
+
+void PageRecorder::attachAxes(LinearAxis &x, LinearAxis &y, LinearAxis &z, LinearAxis &e) {
+  axes[0] = &x; axes[1] = &y; axes[2] = &z; axes[3] = &e;
+  LOOP_L_N(i, 4) last_steps[i] = axes[i]->position * dir_sign[i];
+}
+
+void PageRecorder::sampleBlocks() {
+  const block_index_t head = planner.block_buffer_head, tail = planner.block_buffer_tail;
+  queued += block_ring_t::distance(last_head, head);
+  completed += block_ring_t::distance(last_tail, tail);
+  last_head = head;
+  last_tail = tail;
+}
+
+bool PageRecorder::skipping(const uint32_t seq) {
+  while (!skips.empty() && completed >= skips.front().last) skips.pop_front();
+  for (const PassThrough &s : skips) if (WITHIN(seq, s.first, s.last - 1)) return true;
+  return false;
+}
+
+void PageRecorder::tick() {
+  if (!axes[0]) return;
+  sampleBlocks();
+
+  int32_t delta[4];
+  bool moved = false;
+  LOOP_L_N(i, 4) {
+    const int32_t steps = axes[i]->position * dir_sign[i];
+    delta[i] = steps - last_steps[i];
+    last_steps[i] = steps;
+    if (delta[i] || carry[i]) moved = true;
+  }
+
+  // Steps in this segment belong to the block being run, or the one just finished
+  const bool busy = planner.has_blocks_queued();
+  if ((busy || moved) && (busy || completed) && !skipping(busy ? completed : completed - 1))
+    addSegment(delta);
+
+  processRecords();
+}
+
+void PageRecorder::addSegment(const int32_t (&delta)[4]) {
+  int8_t seg[4];
+  LOOP_L_N(i, 4) {
+    // Steps that don't fit in one segment move on to the next
+    const int32_t want = delta[i] + carry[i];
+    seg[i] = constrain(want, -Cfg::SEGMENT_STEPS, Cfg::SEGMENT_STEPS);
+    carry[i] = want - seg[i];
+    if (carry[i]) overflows++;
+  }
+
+  if (!Cfg::DIRECTIONAL) {
+    // Each page has one direction per axis
+    LOOP_L_N(i, 4) if (seg[i] && page_dir[i] && (seg[i] > 0) != (page_dir[i] > 0)) { finalizePage(); break; }
+    LOOP_L_N(i, 4) if (seg[i]) page_dir[i] = seg[i] > 0 ? 1 : -1;
+  }
+
+  memcpy(segments[segment_count], seg, sizeof(seg));
+  if (++segment_count == Cfg::SEGMENTS) finalizePage();
+}
+
+void PageRecorder::finalizePage() {
+  if (segment_count) {
+    uint8_t data[Cfg::PAGE_SIZE] = { 0 };
+    uint16_t size, ticks;
+
+    #if STEPPER_PAGE_FORMAT == SP_4x4D_128
+      // Signed nibbles, padded with idle segments since only whole pages are counted
+      for (uint16_t i = 0; i < Cfg::SEGMENTS; i++) {
+        const int8_t * const s = segments[i];
+        const bool used = i < segment_count;
+        data[i * 2]     = (used ? s[0] + 7 : 7) << 4 | (used ? s[1] + 7 : 7);
+        data[i * 2 + 1] = (used ? s[2] + 7 : 7) << 4 | (used ? s[3] + 7 : 7);
+      }
+      size = Cfg::PAGE_SIZE;
+      ticks = Cfg::TOTAL_STEPS;
+    #elif STEPPER_PAGE_FORMAT == SP_4x2_256
+      for (uint16_t i = 0; i < segment_count; i++) {
+        const int8_t * const s = segments[i];
+        data[i] = ABS(s[0]) << 6 | ABS(s[1]) << 4 | ABS(s[2]) << 2 | ABS(s[3]);
+      }
+      size = segment_count;
+      ticks = segment_count * Cfg::SEGMENT_STEPS;
+    #elif STEPPER_PAGE_FORMAT == SP_4x1_512
+      for (uint16_t i = 0; i < segment_count; i++) {
+        const int8_t * const s = segments[i];
+        const uint8_t bits = ABS(s[0]) << 3 | ABS(s[1]) << 2 | ABS(s[2]) << 1 | ABS(s[3]);
+        data[i >> 1] |= (i & 1) ? bits << 4 : bits;
+      }
+      size = (segment_count + 1) / 2;
+      ticks = segment_count;
+    #endif
+
+    // Page frame, as sent by a host: control char, page, [size,] data, checksum
+    uint8_t checksum = 0;
+    for (uint16_t i = 0; i < size; i++) checksum ^= data[i];
+    fputc(Cfg::CONTROL_CHAR, out);
+    fputc(page_idx, out);
+    if (!Cfg::DIRECTIONAL) fputc(size == 256 ? 0 : size, out);
+    fwrite(data, 1, size, out);
+    fputc(checksum, out);
+    fputc('\n', out);
+
+    fprintf(out, "G6 I%u R%u", page_idx, rate);
+    if (!Cfg::DIRECTIONAL)
+      fprintf(out, " X%d Y%d Z%d E%d", page_dir[0] >= 0, page_dir[1] >= 0, page_dir[2] >= 0, page_dir[3] >= 0);
+    if (ticks != Cfg::TOTAL_STEPS) fprintf(out, " S%u", ticks);
+    fputc('\n', out);
+
+    page_idx = (page_idx + 1) % Cfg::NUM_PAGES;
+    synced = false;
+    segment_count = 0;
+    ZERO(page_dir);
+    pages++;
+  }
+
+  fputs(page_text.c_str(), out);
+  page_text.clear();
+}
+
+// Write out pass-through commands once the blocks before them have been run
+void PageRecorder::processRecords() {
+  while (!records.empty()) {
+    const PassThrough &r = records.front();
+    if (r.last == UINT32_MAX || completed < r.first) break;
+    if (r.flush) {
+      finalizePage();
+      if (!synced) { fputs("G6\n", out); synced = true; }
+      fputs(r.text.c_str(), out);
+    }
+    else
+      page_text += r.text;
+    records.pop_front();
+  }
+}
+
+static void write_line(const std::string &s) {
+  for (const char c : s) usb_serial.receive_buffer.write(c);
+}
+
+bool PageRecorder::feedSerial() {
+  sampleBlocks();
+  const bool idle = !queue.has_commands_queued();
+
+  switch (phase) {
+    case FEED_WAIT_AFTER: {
+      PassThrough &r = records.back();
+      if (!planner.has_blocks_queued()) r.flush = true;   // Waited for the planner
+      if (!idle) return true;
+      r.last = skips.back().last = queued;
+      if (r.last > r.first) r.flush = true;               // Planned its own moves
+      phase = FEED_READY;
+    }
+    // fallthru
+
+    case FEED_READY: {
+      char buffer[MAX_CMD_SIZE + 2];
+      if (!fgets(buffer, sizeof(buffer), stdin)) return false;
+      line = buffer;
+      if (line.back() != '\n') line += '\n';
+
+      // Compile G0-G3 and G5
+      const char *p = buffer;
+      while (*p == ' ') p++;
+      if (*p == 'N') { p++; while (NUMERIC_SIGNED(*p)) p++; while (*p == ' ') p++; }
+      const bool is_g = *p == 'G' || *p == 'g', motion = is_g && (p[1] >= '0' && p[1] <= '5' && p[1] != '4') && !NUMERIC(p[2]);
+      is_g92 = is_g && p[1] == '9' && p[2] == '2' && !NUMERIC(p[3]);
+      if (motion || *p == ';' || *p == '\n' || *p == '\r' || !*p) {
+        write_line(line);
+        return true;
+      }
+      phase = FEED_WAIT_BEFORE;
+    }
+    // fallthru
+
+    case FEED_WAIT_BEFORE: {
+      // Everything before it has been planned, so its blocks start here
+      if (!idle) return true;
+      // G92 applies to the planner position, so it must follow the pages
+      PassThrough r = { queued, UINT32_MAX, is_g92 || !planner.has_blocks_queued(), line };
+      records.push_back(r);
+      skips.push_back(r);
+      write_line(line);
+      phase = FEED_WAIT_AFTER;
+    } return true;
+  }
+  return true;
+}
+
+void PageRecorder::finish() {
+  if (!out) return;
+  sampler.disable();
+  tick();
+  if (!records.empty() && records.back().last == UINT32_MAX) records.back().last = queued;
+  completed = UINT32_MAX;
+  processRecords();
+  finalizePage();
+
+  // The planner didn't follow the pages, so have it pick up where they ended
+  if (!synced) fputs("G6\n", out);
+  fclose(out);
+  out = nullptr;
+
+  fprintf(stderr, "Compiled %u pages at %u steps/s\n", pages, rate);
+  if (overflows)
+    fprintf(stderr, "Warning: %u segments exceeded %d steps and were spread out. Use a higher --page-rate.\n", overflows, Cfg::SEGMENT_STEPS);
+}
+
+#endif // DIRECT_STEPPING
+#endif // __PLAT_LINUX__
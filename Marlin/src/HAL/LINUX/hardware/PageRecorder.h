@@ -0,0 +1,67 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "LinearAxis.h"
+
+/**
+ * Ahead-of-time compiler for G6 direct stepping.
+ *
+ * Replays G-code through the firmware in virtual time and samples the step
+ * counts of the simulated axes once per page segment. The steps are written
+ * out as page frames and G6 commands in the page format this build was
+ * configured with, so the same configuration can print them from SD (or
+ * stream them) with no planning or kinematics at runtime.
+ *
+ * G0-G3 and G5 are compiled. Everything else passes through as text, in order,
+ * and runs on the printer. Motion of its own (G28, probing...) is left out of
+ * the pages. Commands that wait for the planner to empty (those included) end
+ * the current page and a bare G6 re-syncs the planner before them, since the
+ * planner does not follow the steps of a page.
+ */
+class PageRecorder {
+public:
+  static bool begin(const char *path, const uint32_t rate);
+  static bool isEnabled() { return out != nullptr; }
+  static void attachAxes(LinearAxis &x, LinearAxis &y, LinearAxis &z, LinearAxis &e);
+
+  // Feed the firmware the next line of input. Return false at the end of the input.
+  static bool feedSerial();
+
+  // Write out everything still pending once the firmware is idle
+  static void finish();
+
+private:
+  static void tick();
+  static void sampleBlocks();
+  static void addSegment(const int32_t (&delta)[4]);
+  static void finalizePage();
+  static void processRecords();
+  static bool skipping(const uint32_t seq);
+
+  static FILE *out;
+  static uint32_t rate;
+  static LinearAxis *axes[4];
+};
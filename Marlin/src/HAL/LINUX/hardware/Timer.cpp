@@ -22,6 +22,7 @@
 #ifdef __PLAT_LINUX__
 
 #include "Timer.h"
+#include "Kernel.h"
 #include <stdio.h>
 
 Timer::Timer() {
@@ -34,10 +35,12 @@ Timer::Timer() {
   period = 0;
   start_time = 0;
   avg_error = 0;
+  next_fire = 0;
+  in_callback = false;
 }
 
 Timer::~Timer() {
-  timer_delete(timerid);
+  if (timerid) timer_delete(timerid);
 }
 
 void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
@@ -47,6 +50,12 @@ void Timer::init(uint32_t sig_id, uint32_t sim_freq, callback_fn* fn) {
   frequency = sim_freq;
   cbfn = fn;
 
+  // In virtual time the Kernel fires the timer, no signals involved
+  if (Clock::isVirtual()) {
+    Kernel::attachTimer(this);
+    return;
+  }
+
   sa.sa_flags = SA_SIGINFO;
   sa.sa_sigaction = Timer::handler;
   sigemptyset(&sa.sa_mask);
@@ -73,6 +82,10 @@ void Timer::start(uint32_t frequency) {
 }
 
 void Timer::enable() {
+  if (Clock::isVirtual()) {
+    active = true;
+    return;
+  }
   if (sigprocmask(SIG_UNBLOCK, &mask, nullptr) == -1) {
     return; // todo: handle error
   }
@@ -81,6 +94,10 @@ void Timer::enable() {
 }
 
 void Timer::disable() {
+  if (Clock::isVirtual()) {
+    active = false;
+    return;
+  }
   if (sigprocmask(SIG_SETMASK, &mask, nullptr) == -1) {
     return; // todo: handle error
   }
@@ -88,6 +105,17 @@ void Timer::disable() {
 }
 
 void Timer::setCompare(uint32_t compare) {
+  if (Clock::isVirtual()) {
+    // Like a compare match that resets the counter, the period runs from the start of
+    // the current interrupt when called from the handler, otherwise from now.
+    const uint64_t ns = Clock::ticksToNanos(compare, frequency);
+    this->compare = compare;
+    this->period = ns ? ns : 1;
+    if (!in_callback) this->start_time = Clock::nanos();
+    this->next_fire = this->start_time + this->period;
+    return;
+  }
+
   uint32_t nsec_offset = 0;
   if (active) {
     nsec_offset = Clock::nanos() - this->start_time; // calculate how long the timer would have been running for
@@ -110,7 +138,16 @@ void Timer::setCompare(uint32_t compare) {
   this->start_time = Clock::nanos();
 }
 
+void Timer::fire() {
+  start_time = next_fire;
+  next_fire += period;
+  in_callback = true;
+  cbfn();
+  in_callback = false;
+}
+
 uint32_t Timer::getCount() {
+  if (Clock::isVirtual()) Kernel::spin(Clock::ticksToNanos(1, frequency)); // Polling the counter takes a tick
   return Clock::nanosToTicks(Clock::nanos() - this->start_time, frequency);
 }
 
@@ -48,6 +48,11 @@ public:
   uint32_t getOverruns() {return overruns;}
   uint32_t getAvgError() {return avg_error;}
 
+  // Virtual time: when the Kernel should call fire() next, if armed
+  bool armed() {return period != 0;}
+  uint64_t nextFire() {return next_fire;}
+  void fire();
+
   intptr_t getID() {
     return (*(intptr_t*)timerid);
   }
@@ -73,4 +78,6 @@ private:
   uint64_t period;
   uint64_t avg_error;
   uint64_t start_time;
+  uint64_t next_fire;
+  bool in_callback;
 };
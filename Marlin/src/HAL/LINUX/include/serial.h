@@ -26,6 +26,7 @@
   #include "../../../feature/e_parser.h"
 #endif
 #include "../../../core/serial_hook.h"
+#include "../hardware/Clock.h"
 
 #include <stdarg.h>
 #include <stdio.h>
@@ -62,6 +63,15 @@ public:
     return true;
   }
 
+  // The unread values that are contiguous in the buffer, up to the wrap
+  uint32_t span(const T **data) volatile {
+    const uint32_t r = mask(index_read), n = available();
+    *data = const_cast<const T*>(&buffer[r]);
+    return n < buffer_size - r ? n : buffer_size - r;
+  }
+
+  void consume(const uint32_t count) volatile { index_read += count; }
+
 private:
   uint32_t mask(uint32_t val) volatile {
     return buffer_mask & val;
@@ -87,8 +97,13 @@ struct HalSerial {
 
   int read() { return receive_buffer.read(); }
 
+  // Read in place: the received bytes up to the wrap of the buffer, then how many were taken
+  uint16_t rxSpan(const uint8_t **data) { return (uint16_t)receive_buffer.span(data); }
+  void rxConsume(const uint16_t count)  { receive_buffer.consume(count); }
+
   size_t write(char c) {
     if (!host_connected) return 0;
+    if (Clock::isVirtual()) return fputc(c, stdout) != EOF; // No writer thread in virtual time
     while (!transmit_buffer.free());
     return transmit_buffer.write(c);
   }
@@ -22,12 +22,23 @@
 
 #include "../../inc/MarlinConfig.h"
 #include "../shared/Delay.h"
+#include "../../gcode/queue.h"
+#include "../../module/planner.h"
+#include "../../module/stepper.h"
 #include "hardware/IOLoggerCSV.h"
 #include "hardware/Heater.h"
 #include "hardware/LinearAxis.h"
+#include "hardware/Kernel.h"
+#include "hardware/Benchmark.h"
+#if ENABLED(DIRECT_STEPPING)
+  #include "hardware/PageRecorder.h"
+  #include "../../feature/direct_stepping.h"
+#endif
 
 #include <stdio.h>
 #include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
 #include <thread>
 #include <iostream>
 #include <fstream>
@@ -38,72 +49,217 @@ extern void loop();
 // simple stdout / stdin implementation for fake serial port
 void write_serial_thread() {
   for (;;) {
-    for (std::size_t i = usb_serial.transmit_buffer.available(); i > 0; i--) {
-      fputc(usb_serial.transmit_buffer.read(), stdout);
+    std::size_t i = usb_serial.transmit_buffer.available();
+    if (i) {
+      for (; i > 0; i--) fputc(usb_serial.transmit_buffer.read(), stdout);
+      fflush(stdout); // A host on a pipe is waiting for its "ok"
     }
     std::this_thread::yield();
   }
 }
 
+// Read up to a newline, byte by byte so binary input passes through. Return false at EOF.
+// With DIRECT_STEPPING page frames go to the page manager, as the AVR serial ISR does,
+// and wait while their page is in use, as a host with flow control would.
+static bool read_serial_line() {
+  #if ENABLED(DIRECT_STEPPING)
+    static bool line_start = true;
+  #endif
+  for (std::size_t len = usb_serial.receive_buffer.free(); len; len--) {
+    const int c = getchar();
+    if (c == EOF) return false;
+    #if ENABLED(DIRECT_STEPPING)
+      const int8_t page = page_manager.store_stream_char(c, line_start);
+      if (page < 0) { ungetc(c, stdin); break; }
+      line_start = (c == '\n');
+      if (page > 0) continue;
+    #endif
+    usb_serial.receive_buffer.write(c);
+    if (c == '\n') break;
+  }
+  return true;
+}
+
 void read_serial_thread() {
-  char buffer[255] = {};
   for (;;) {
-    std::size_t len = _MIN(usb_serial.receive_buffer.free(), 254U);
-    if (fgets(buffer, len, stdin))
-      for (std::size_t i = 0; i < strlen(buffer); i++)
-        usb_serial.receive_buffer.write(buffer[i]);
+    read_serial_line();
     std::this_thread::yield();
   }
 }
 
-void simulation_loop() {
-  Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
-  Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
-  LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
-  LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
-  LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
-  LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+// With --trace, the commanded and the motor XY positions every millisecond of simulated time
+static FILE *trace_file = nullptr;
+
+static void trace_positions(const LinearAxis &x_axis, const LinearAxis &y_axis) {
+  static uint64_t next_ns = 0;
+  static int32_t offset_x = 0, offset_y = 0;
+  const uint64_t now = Clock::nanos();
+  if (now < next_ns) return;
+  next_ns = now + 1000000;
+
+  const int32_t x = stepper.position(X_AXIS), y = stepper.position(Y_AXIS),
+                motor_x = INVERT_X_DIR ? -x_axis.position : x_axis.position,
+                motor_y = INVERT_Y_DIR ? -y_axis.position : y_axis.position;
+  // Line the motors up with the counted position whenever motion has settled (e.g., after G92)
+  if (!planner.has_blocks_queued() && !TERN0(HAS_SHAPING, stepper.shaping_busy())) {
+    offset_x = motor_x - x;
+    offset_y = motor_y - y;
+    return;
+  }
+  const float sx = planner.settings.axis_steps_per_mm[X_AXIS], sy = planner.settings.axis_steps_per_mm[Y_AXIS];
+  fprintf(trace_file, "%.3f,%.4f,%.4f,%.4f,%.4f\n", now * 1e-6, x / sx, y / sy,
+    (motor_x - offset_x) / sx, (motor_y - offset_y) / sy);
+}
+
+void simulation_update() {
+  static Heater hotend(HEATER_0_PIN, TEMP_0_PIN);
+  static Heater bed(HEATER_BED_PIN, TEMP_BED_PIN);
+  static LinearAxis x_axis(X_ENABLE_PIN, X_DIR_PIN, X_STEP_PIN, X_MIN_PIN, X_MAX_PIN);
+  static LinearAxis y_axis(Y_ENABLE_PIN, Y_DIR_PIN, Y_STEP_PIN, Y_MIN_PIN, Y_MAX_PIN);
+  static LinearAxis z_axis(Z_ENABLE_PIN, Z_DIR_PIN, Z_STEP_PIN, Z_MIN_PIN, Z_MAX_PIN);
+  static LinearAxis extruder0(E0_ENABLE_PIN, E0_DIR_PIN, E0_STEP_PIN, P_NC, P_NC);
+
+  #if ENABLED(DIRECT_STEPPING)
+    static bool attached = false;
+    if (!attached && PageRecorder::isEnabled()) {
+      PageRecorder::attachAxes(x_axis, y_axis, z_axis, extruder0);
+      attached = true;
+    }
+  #endif
 
   #ifdef GPIO_LOGGING
-    IOLoggerCSV logger("all_gpio_log.csv");
-    Gpio::attachLogger(&logger);
+    static IOLoggerCSV logger("all_gpio_log.csv");
+    static std::ofstream position_log;
+    static int32_t x, y, z;
+    if (!position_log.is_open()) {
+      Gpio::attachLogger(&logger);
+      position_log.open("axis_position_log.csv");
+    }
+  #endif
+
+  hotend.update();
+  bed.update();
+
+  x_axis.update();
+  y_axis.update();
+  z_axis.update();
+  extruder0.update();
 
-    std::ofstream position_log;
-    position_log.open("axis_position_log.csv");
+  if (trace_file) trace_positions(x_axis, y_axis);
 
-    int32_t x,y,z;
+  #ifdef GPIO_LOGGING
+    if (x_axis.position != x || y_axis.position != y || z_axis.position != z) {
+      uint64_t update = _MAX(x_axis.last_update, y_axis.last_update, z_axis.last_update);
+      position_log << update << ", " << x_axis.position << ", " << y_axis.position << ", " << z_axis.position << std::endl;
+      position_log.flush();
+      x = x_axis.position;
+      y = y_axis.position;
+      z = z_axis.position;
+    }
+    // flush the logger
+    logger.flush();
   #endif
+}
 
+void simulation_loop() {
   for (;;) {
+    simulation_update();
+    std::this_thread::yield();
+  }
+}
 
-    hotend.update();
-    bed.update();
-
-    x_axis.update();
-    y_axis.update();
-    z_axis.update();
-    extruder0.update();
-
-    #ifdef GPIO_LOGGING
-      if (x_axis.position != x || y_axis.position != y || z_axis.position != z) {
-        uint64_t update = _MAX(x_axis.last_update, y_axis.last_update, z_axis.last_update);
-        position_log << update << ", " << x_axis.position << ", " << y_axis.position << ", " << z_axis.position << std::endl;
-        position_log.flush();
-        x = x_axis.position;
-        y = y_axis.position;
-        z = z_axis.position;
-      }
-      // flush the logger
-      logger.flush();
-    #endif
+/**
+ * Virtual time: serial input is read on the main thread, one line each
+ * time the firmware has drained the last one, so the same input stream
+ * always arrives at the same simulated time. Once the input is exhausted
+ * and every command and move has completed the simulator exits.
+ */
+static bool stdin_eof = false;
+static std::chrono::steady_clock::time_point wall_start;
 
-    std::this_thread::yield();
+void virtual_serial_task() {
+  if (!usb_serial.receive_buffer.empty()) return;
+
+  if (!stdin_eof) {
+    fflush(stdout);
+    #if ENABLED(DIRECT_STEPPING)
+      const bool more = PageRecorder::isEnabled() ? PageRecorder::feedSerial() : read_serial_line();
+    #else
+      const bool more = read_serial_line();
+    #endif
+    if (!more) {
+      stdin_eof = true;
+      Benchmark::inputDone();
+    }
+  }
+  else if (!queue.has_commands_queued() && !planner.has_blocks_queued() && !TERN0(HAS_SHAPING, stepper.shaping_busy())) {
+    fflush(stdout);
+    TERN_(DIRECT_STEPPING, PageRecorder::finish());
+    if (trace_file) fclose(trace_file);
+    const std::chrono::duration<double> wall = std::chrono::steady_clock::now() - wall_start;
+    fprintf(stderr, "Simulated %.3fs in %.3fs\n", Clock::seconds(), wall.count());
+    Benchmark::report(stderr);
+    exit(0);
   }
 }
 
-int main() {
-  std::thread write_serial (write_serial_thread);
-  std::thread read_serial (read_serial_thread);
+/**
+ * --virtual-time   Run on a deterministic simulated clock (see Kernel.h)
+ * --benchmark      Report planner throughput and ISR latency at exit
+ * --cpu-scale=<f>  Charge host CPU time x f to the simulated clock, so a
+ *                  slower target can be approximated on a fast host
+ * --trace=<file>   Write the commanded and the motor XY positions (mm) every
+ *                  millisecond of motion to a CSV file: ms,x,y,motor_x,motor_y
+ *
+ * With DIRECT_STEPPING:
+ * --compile-pages=<file>  Compile the input to G6 pages (see PageRecorder.h)
+ * --page-rate=<hz>        Step rate of the compiled pages (default 20000)
+ */
+int main(int argc, char *argv[]) {
+  double cpu_scale = 0;
+  #if ENABLED(DIRECT_STEPPING)
+    const char *page_file = nullptr;
+    uint32_t page_rate = 20000;
+  #endif
+  for (int i = 1; i < argc; i++) {
+    if (!strcmp(argv[i], "--virtual-time"))
+      Clock::setVirtual(true);
+    else if (!strcmp(argv[i], "--benchmark")) {
+      Clock::setVirtual(true);
+      Benchmark::enable();
+    }
+    else if (!strncmp(argv[i], "--cpu-scale=", 12) && (cpu_scale = atof(argv[i] + 12)) > 0)
+      Clock::setVirtual(true);
+    else if (!strncmp(argv[i], "--trace=", 8)) {
+      if (!(trace_file = fopen(argv[i] + 8, "w"))) {
+        fprintf(stderr, "Can't create %s\n", argv[i] + 8);
+        return 1;
+      }
+      Clock::setVirtual(true);
+    }
+    #if ENABLED(DIRECT_STEPPING)
+      else if (!strncmp(argv[i], "--compile-pages=", 16)) {
+        page_file = argv[i] + 16;
+        Clock::setVirtual(true);
+      }
+      else if (!strncmp(argv[i], "--page-rate=", 12) && (page_rate = atoi(argv[i] + 12)) > 0) { /* nada */ }
+    #endif
+    else {
+      fprintf(stderr, "Usage: %s [--virtual-time] [--benchmark] [--cpu-scale=<factor>] [--trace=<file>]"
+        TERN_(DIRECT_STEPPING, " [--compile-pages=<file>] [--page-rate=<hz>]") "\n", argv[0]);
+      return 1;
+    }
+  }
+
+  const bool virtual_time = Clock::isVirtual();
+  wall_start = std::chrono::steady_clock::now();
+
+  if (!virtual_time) {
+    std::thread write_serial (write_serial_thread);
+    std::thread read_serial (read_serial_thread);
+    write_serial.detach();
+    read_serial.detach();
+  }
 
   #ifdef MYSERIAL1
     MYSERIAL1.begin(BAUDRATE);
@@ -116,19 +272,33 @@ int main() {
 
   HAL_timer_init();
 
-  std::thread simulation (simulation_loop);
+  if (virtual_time) {
+    simulation_update();
+    Kernel::attachTask(simulation_update);
+    Kernel::attachTask(virtual_serial_task);
+    Kernel::setProfiling(Benchmark::isEnabled(), cpu_scale);
+    #if ENABLED(DIRECT_STEPPING)
+      if (page_file && !PageRecorder::begin(page_file, page_rate)) {
+        fprintf(stderr, "Can't open %s\n", page_file);
+        return 1;
+      }
+    #endif
+  }
+  else {
+    std::thread simulation (simulation_loop);
+    simulation.detach();
+  }
 
   DELAY_US(10000);
 
   setup();
   for (;;) {
     loop();
-    std::this_thread::yield();
+    if (virtual_time)
+      Kernel::yield();
+    else
+      std::this_thread::yield();
   }
-
-  simulation.join();
-  write_serial.join();
-  read_serial.join();
 }
 
 #endif // __PLAT_LINUX__
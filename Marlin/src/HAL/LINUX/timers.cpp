@@ -28,6 +28,9 @@
 /**
  * Use POSIX signals to attempt to emulate Interrupts
  * This has many limitations and is not fit for the purpose
+ *
+ * With --virtual-time the timers are fired by the Kernel instead,
+ * in simulated time and in a repeatable order (see hardware/Kernel.h)
  */
 
 HAL_STEP_TIMER_ISR();
@@ -70,6 +70,10 @@ CALL_IF_EXISTS_IMPL(void, flushTX);
 CALL_IF_EXISTS_IMPL(bool, connected, true);
 CALL_IF_EXISTS_IMPL(SerialFeature, features, SerialFeature::None);
 
+// Reading received bytes in place is optional. Ports without it report no span and are read byte by byte.
+CALL_IF_EXISTS_IMPL(uint16_t, rxSpan, 0);
+CALL_IF_EXISTS_IMPL(void, rxConsume);
+
 // A simple forward struct to prevent the compiler from selecting print(double, int) as a default overload
 // for any type other than double/float. For double/float, a conversion exists so the call will be invisible.
 struct EnsureDouble {
@@ -62,6 +62,8 @@ struct BaseSerial : public SerialBase< BaseSerial<SerialT> >, public SerialT {
   // We don't care about indices here, since if one can call us, it's the right index anyway
   int available(serial_index_t) { return (int)SerialT::available(); }
   int read(serial_index_t)      { return (int)SerialT::read(); }
+  uint16_t rxSpan(serial_index_t, const uint8_t **data)  { return CALL_IF_EXISTS(uint16_t, static_cast<SerialT*>(this), rxSpan, data); }
+  void rxConsume(serial_index_t, const uint16_t count)   { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), rxConsume, count); }
   bool connected()              { return CALL_IF_EXISTS(bool, static_cast<SerialT*>(this), connected);; }
   void flushTX()                { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), flushTX); }
 
@@ -104,6 +106,8 @@ struct ConditionalSerial : public SerialBase< ConditionalSerial<SerialT> > {
   int read(serial_index_t)        { return (int)out.read(); }
   int available()                 { return (int)out.available(); }
   int read()                      { return (int)out.read(); }
+  uint16_t rxSpan(serial_index_t, const uint8_t **data) { return CALL_IF_EXISTS(uint16_t, &out, rxSpan, data); }
+  void rxConsume(serial_index_t, const uint16_t count)  { CALL_IF_EXISTS(void, &out, rxConsume, count); }
   SerialFeature features(serial_index_t index) const  { return CALL_IF_EXISTS(SerialFeature, &out, features, index);  }
 
   ConditionalSerial(bool & conditionVariable, SerialT & out, const bool e) : BaseClassT(e), condition(conditionVariable), out(out) {}
@@ -129,6 +133,8 @@ struct ForwardSerial : public SerialBase< ForwardSerial<SerialT> > {
   int read(serial_index_t)      { return (int)out.read(); }
   int available()               { return (int)out.available(); }
   int read()                    { return (int)out.read(); }
+  uint16_t rxSpan(serial_index_t, const uint8_t **data) { return CALL_IF_EXISTS(uint16_t, &out, rxSpan, data); }
+  void rxConsume(serial_index_t, const uint16_t count)  { CALL_IF_EXISTS(void, &out, rxConsume, count); }
   SerialFeature features(serial_index_t index) const  { return CALL_IF_EXISTS(SerialFeature, &out, features, index);  }
 
   ForwardSerial(const bool e, SerialT & out) : BaseClassT(e), out(out) {}
@@ -156,6 +162,8 @@ struct RuntimeSerial : public SerialBase< RuntimeSerial<SerialT> >, public Seria
 
   int available(serial_index_t)  { return (int)SerialT::available(); }
   int read(serial_index_t)       { return (int)SerialT::read(); }
+  uint16_t rxSpan(serial_index_t, const uint8_t **data) { return CALL_IF_EXISTS(uint16_t, static_cast<SerialT*>(this), rxSpan, data); }
+  void rxConsume(serial_index_t, const uint16_t count)  { CALL_IF_EXISTS(void, static_cast<SerialT*>(this), rxConsume, count); }
   using SerialT::available;
   using SerialT::read;
   using SerialT::flush;
@@ -245,6 +253,19 @@ struct MultiSerial : public SerialBase< MultiSerial< REPEAT(NUM_SERIAL, _S_NAME)
     #undef _S_READ
     return -1;
   }
+  uint16_t rxSpan(serial_index_t index, const uint8_t **data) {
+    uint8_t pos = offset;
+    #define _S_SPAN(N) if (index.within(pos, pos + step - 1)) return CALL_IF_EXISTS(uint16_t, &serial##N, rxSpan, index, data); else pos += step;
+    REPEAT(NUM_SERIAL, _S_SPAN);
+    #undef _S_SPAN
+    return 0;
+  }
+  void rxConsume(serial_index_t index, const uint16_t count) {
+    uint8_t pos = offset;
+    #define _S_CONSUME(N) if (index.within(pos, pos + step - 1)) return CALL_IF_EXISTS(void, &serial##N, rxConsume, index, count); else pos += step;
+    REPEAT(NUM_SERIAL, _S_CONSUME);
+    #undef _S_CONSUME
+  }
   void begin(const long br) {
     #define _S_BEGIN(N) if (portMask.enabled(output[N])) serial##N.begin(br);
     REPEAT(NUM_SERIAL, _S_BEGIN);
@@ -244,10 +244,67 @@ void print_bilinear_leveling_grid() {
   }
 #endif // ABL_BILINEAR_SUBDIVISION
 
+#if ENABLED(ABL_BICUBIC_INTERPOLATION)
+
+  /**
+   * Bicubic (Catmull-Rom) patches over the probed grid. The slopes at each
+   * point, in Z per cell, are found once. The patch of a cell is then built
+   * from its corners when a move enters the cell, and kept for later queries.
+   * Beyond the edges the grid is continued linearly, as with the virtual grid.
+   */
+  static bed_mesh_t slope_x, slope_y, twist;
+  static xy_int8_t patch_cell { -1, -1 };
+  static float patch[4][4];       // The cell's patch, by powers of the X and Y ratios
+
+  static void bed_level_bicubic_slopes() {
+    // Central differences, or one-sided at the edges
+    #define _PREV(I)   ((I) ? (I) - 1 : (I))
+    #define _NEXT(A,I) ((I) < GRID_MAX_CELLS_##A ? (I) + 1 : (I))
+    GRID_LOOP(x, y) {
+      const uint8_t x0 = _PREV(x), x1 = _NEXT(X, x), y0 = _PREV(y), y1 = _NEXT(Y, y);
+      slope_x[x][y] = (z_values[x1][y] - z_values[x0][y]) / (x1 - x0);
+      slope_y[x][y] = (z_values[x][y1] - z_values[x][y0]) / (y1 - y0);
+    }
+    GRID_LOOP(x, y) {
+      const uint8_t y0 = _PREV(y), y1 = _NEXT(Y, y);
+      twist[x][y] = (slope_x[x][y1] - slope_x[x][y0]) / (y1 - y0);
+    }
+    #undef _PREV
+    #undef _NEXT
+    patch_cell.set(-1, -1);
+  }
+
+  static void bed_level_bicubic_patch(const xy_int8_t &g) {
+    // Heights and slopes at the corners, as a Hermite patch
+    const uint8_t x = g.x, y = g.y;
+    const float f[4][4] = {
+      { z_values[x][y],       z_values[x][y + 1],       slope_y[x][y],       slope_y[x][y + 1]     },
+      { z_values[x + 1][y],   z_values[x + 1][y + 1],   slope_y[x + 1][y],   slope_y[x + 1][y + 1] },
+      { slope_x[x][y],        slope_x[x][y + 1],        twist[x][y],         twist[x][y + 1]       },
+      { slope_x[x + 1][y],    slope_x[x + 1][y + 1],    twist[x + 1][y],     twist[x + 1][y + 1]   }
+    };
+    static const float m[4][4] = { { 1, 0, 0, 0 }, { 0, 0, 1, 0 }, { -3, 3, -2, -1 }, { 2, -2, 1, 1 } };
+
+    // Powers of the ratios: patch = M * F * M^T
+    float mf[4][4];
+    LOOP_L_N(i, 4) LOOP_L_N(j, 4) {
+      mf[i][j] = 0;
+      LOOP_L_N(k, 4) mf[i][j] += m[i][k] * f[k][j];
+    }
+    LOOP_L_N(i, 4) LOOP_L_N(j, 4) {
+      patch[i][j] = 0;
+      LOOP_L_N(k, 4) patch[i][j] += mf[i][k] * m[j][k];
+    }
+    patch_cell = g;
+  }
+
+#endif // ABL_BICUBIC_INTERPOLATION
+
 // Refresh after other values have been updated
 void refresh_bed_level() {
   bilinear_grid_factor = bilinear_grid_spacing.reciprocal();
   TERN_(ABL_BILINEAR_SUBDIVISION, bed_level_virt_interpolate());
+  TERN_(ABL_BICUBIC_INTERPOLATION, bed_level_bicubic_slopes());
 }
 
 #if ENABLED(ABL_BILINEAR_SUBDIVISION)
@@ -264,6 +321,40 @@ void refresh_bed_level() {
   #define ABL_BG_GRID(X,Y)  z_values[X][Y]
 #endif
 
+#if ENABLED(ABL_BICUBIC_INTERPOLATION)
+
+// Get the Z adjustment from the bicubic patch of the cell
+float bilinear_z_offset(const xy_pos_t &raw) {
+  xy_float_t ratio = (raw - bilinear_start.asFloat()) * bilinear_grid_factor;
+  const xy_int8_t g = {
+    int8_t(constrain(FLOOR(ratio.x), 0, GRID_MAX_CELLS_X - 1)),
+    int8_t(constrain(FLOOR(ratio.y), 0, GRID_MAX_CELLS_Y - 1))
+  };
+  if (g != patch_cell) bed_level_bicubic_patch(g);
+  ratio -= g.asFloat();
+
+  // Beyond the grid continue the slope at the edge, or keep the edge height
+  const xy_float_t in = { constrain(ratio.x, 0, 1), constrain(ratio.y, 0, 1) };
+  #if ENABLED(EXTRAPOLATE_BEYOND_GRID)
+    const xy_float_t out = ratio - in;
+  #else
+    const xy_float_t out { 0, 0 };
+  #endif
+
+  // Horner's rule in Y for each power of X, then in X, with the slopes
+  float z = 0, dz = 0;
+  for (uint8_t i = 4; i--;) {
+    const float * const a = patch[i],
+                c = ((a[3] * in.y + a[2]) * in.y + a[1]) * in.y + a[0]
+                  + out.y * ((3 * a[3] * in.y + 2 * a[2]) * in.y + a[1]);
+    dz = dz * in.x + z;
+    z = z * in.x + c;
+  }
+  return z + out.x * dz;
+}
+
+#else
+
 // Get the Z adjustment for non-linear bed leveling
 float bilinear_z_offset(const xy_pos_t &raw) {
 
@@ -348,6 +439,8 @@ float bilinear_z_offset(const xy_pos_t &raw) {
   return offset;
 }
 
+#endif // !ABL_BICUBIC_INTERPOLATION
+
 #if IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
 
   #define CELL_INDEX(A,V) ((V - bilinear_start.A) * ABL_BG_FACTOR(A))
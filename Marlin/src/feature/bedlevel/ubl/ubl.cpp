@@ -41,6 +41,11 @@ unified_bed_leveling ubl;
   #include "../../../lcd/extui/ui_api.h"
 #endif
 
+#if ENABLED(COMPRESSED_MESH_STORAGE)
+  #include "../../../libs/crc16.h"
+  #include "../../../libs/least_squares_fit.h"
+#endif
+
 #include "math.h"
 
 void unified_bed_leveling::echo_name() { SERIAL_ECHOPGM("Unified Bed Leveling"); }
@@ -133,7 +138,94 @@ void unified_bed_leveling::set_all_mesh_points_to_value(const_float_t value) {
     GRID_LOOP(x, y) out_values[x][y] = store_to_z(stored_values[x][y]);
   }
 
-#endif // OPTIMIZED_MESH_STORAGE
+#elif ENABLED(COMPRESSED_MESH_STORAGE)
+
+  /**
+   * A stored mesh is a least-squares plane plus quantized residuals.
+   * Points are visited in serpentine order and each stores the change in
+   * residual from the previous point as a little-endian base-128 varint:
+   * 0 for an unset (NAN) point, otherwise the zig-zag encoded delta + 1.
+   * Beds are smooth, so most points take a single byte.
+   */
+
+  // CRC of the header after the crc field, plus the used data
+  static uint16_t mesh_store_crc(const mesh_store_t &store) {
+    uint16_t crc = 0;
+    crc16(&crc, &store.size, MESH_STORE_HEADER_SIZE - sizeof(store.crc) + store.size);
+    return crc;
+  }
+
+  static inline float mesh_store_plane(const mesh_store_t &store, const uint8_t i, const uint8_t j) {
+    return store.a * i + store.b * j + store.c;
+  }
+
+  void unified_bed_leveling::set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &store) {
+    memset(&store, 0, MESH_STORE_HEADER_SIZE);
+
+    linear_fit_data lsf;
+    incremental_LSF_reset(&lsf);
+    GRID_LOOP(x, y) if (!isnan(in_values[x][y])) incremental_LSF(&lsf, x, y, in_values[x][y]);
+    if (!finish_incremental_LSF(&lsf)) {
+      store.a = -lsf.A;
+      store.b = -lsf.B;
+      store.c = -lsf.D;
+    }
+
+    // Pack at 2^shift µm. Return false if it doesn't fit.
+    auto pack = [&](const uint8_t shift) {
+      const float scale = 1000.0f / (1UL << shift);
+      int32_t prev = 0;
+      store.size = 0;
+      LOOP_L_N(i, GRID_MAX_POINTS_X) LOOP_L_N(n, GRID_MAX_POINTS_Y) {
+        const uint8_t j = (i & 1) ? GRID_MAX_POINTS_Y - 1 - n : n;
+        const float z = in_values[i][j];
+        uint32_t code = 0;
+        if (!isnan(z)) {
+          const int32_t r = LROUND((z - mesh_store_plane(store, i, j)) * scale), d = r - prev;
+          prev = r;
+          code = ((uint32_t(d) << 1) ^ uint32_t(d >> 31)) + 1;
+        }
+        do {
+          if (store.size >= MESH_STORE_BYTES) return false;
+          store.data[store.size++] = (code & 0x7F) | (code > 0x7F ? 0x80 : 0);
+          code >>= 7;
+        } while (code);
+      }
+      return true;
+    };
+
+    // Coarsen until it fits. At 32mm all deltas are 0, a byte per point.
+    for (store.shift = 0; !pack(store.shift) && store.shift < 15; store.shift++) { /* nada */ }
+
+    store.crc = mesh_store_crc(store);
+  }
+
+  bool unified_bed_leveling::set_mesh_from_store(const mesh_store_t &stored, bed_mesh_t &out_values) {
+    if (stored.size > MESH_STORE_BYTES || stored.shift > 15 || mesh_store_crc(stored) != stored.crc) return false;
+
+    const float scale = float(1UL << stored.shift) / 1000.0f;
+    uint16_t pos = 0;
+    int32_t prev = 0;
+    LOOP_L_N(i, GRID_MAX_POINTS_X) LOOP_L_N(n, GRID_MAX_POINTS_Y) {
+      const uint8_t j = (i & 1) ? GRID_MAX_POINTS_Y - 1 - n : n;
+      uint32_t code = 0;
+      for (uint8_t s = 0;; s += 7) {
+        if (pos >= stored.size || s > 28) return false;
+        const uint8_t b = stored.data[pos++];
+        code |= uint32_t(b & 0x7F) << s;
+        if (!(b & 0x80)) break;
+      }
+      if (code--) {
+        prev += int32_t(code >> 1) ^ -int32_t(code & 1);
+        out_values[i][j] = mesh_store_plane(stored, i, j) + prev * scale;
+      }
+      else
+        out_values[i][j] = NAN;
+    }
+    return pos == stored.size;
+  }
+
+#endif // COMPRESSED_MESH_STORAGE
 
 static void serial_echo_xy(const uint8_t sp, const int16_t x, const int16_t y) {
   SERIAL_ECHO_SP(sp);
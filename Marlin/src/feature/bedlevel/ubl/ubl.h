@@ -43,6 +43,15 @@ struct mesh_index_pair;
 
 #if ENABLED(OPTIMIZED_MESH_STORAGE)
   typedef int16_t mesh_store_t[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
+#elif ENABLED(COMPRESSED_MESH_STORAGE)
+  typedef struct {
+    uint16_t crc;                   // CRC16 of everything that follows, up to data[size]
+    uint16_t size;                  // Bytes used in data[]
+    uint8_t shift;                  // Residual resolution is (1 << shift) µm
+    float a, b, c;                  // Fitted plane z = a * i + b * j + c
+    uint8_t data[MESH_STORE_BYTES]; // Serpentine residual deltas, one varint per point
+  } mesh_store_t;
+  #define MESH_STORE_HEADER_SIZE offsetof(mesh_store_t, data)
 #endif
 
 typedef struct {
@@ -116,6 +125,9 @@ public:
   #if ENABLED(OPTIMIZED_MESH_STORAGE)
     static void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values);
     static void set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values);
+  #elif ENABLED(COMPRESSED_MESH_STORAGE)
+    static void set_store_from_mesh(const bed_mesh_t &in_values, mesh_store_t &stored_values);
+    static bool set_mesh_from_store(const mesh_store_t &stored_values, bed_mesh_t &out_values);
   #endif
   static const float _mesh_index_to_xpos[GRID_MAX_POINTS_X],
                      _mesh_index_to_ypos[GRID_MAX_POINTS_Y];
@@ -758,7 +758,7 @@ void unified_bed_leveling::shift_mesh_height() {
         TERN_(EXTENSIBLE_UI, ExtUI::onMeshUpdate(best.pos, ExtUI::G29_POINT_START));
         const float measured_z = probe.probe_at_point(
                       best.meshpos(),
-                      stow_probe ? PROBE_PT_STOW : PROBE_PT_RAISE, param.V_verbosity
+                      stow_probe ? PROBE_PT_STOW : TERN(FLYING_PROBE, PROBE_PT_FLY, PROBE_PT_RAISE), param.V_verbosity
                     );
         z_values[best.pos.x][best.pos.y] = measured_z;
         #if ENABLED(EXTENSIBLE_UI)
@@ -22,14 +22,16 @@
 
 #include "../inc/MarlinConfigPre.h"
 
-#if ENABLED(BINARY_FILE_TRANSFER)
+#if HAS_BINARY_STREAM
 
 #include "../sd/cardreader.h"
 #include "binary_stream.h"
 
-char* SDFileTransferProtocol::Packet::Open::data = nullptr;
-size_t SDFileTransferProtocol::data_waiting, SDFileTransferProtocol::transfer_timeout, SDFileTransferProtocol::idle_timeout;
-bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_transfer, SDFileTransferProtocol::compression;
+#if ENABLED(BINARY_FILE_TRANSFER)
+  char* SDFileTransferProtocol::Packet::Open::data = nullptr;
+  size_t SDFileTransferProtocol::data_waiting, SDFileTransferProtocol::transfer_timeout, SDFileTransferProtocol::idle_timeout;
+  bool SDFileTransferProtocol::transfer_active, SDFileTransferProtocol::dummy_transfer, SDFileTransferProtocol::compression;
+#endif
 
 BinaryStream binaryStream[NUM_SERIAL];
 
@@ -29,6 +29,10 @@
   #include "../libs/heatshrink/heatshrink_decoder.h"
 #endif
 
+#if ENABLED(BINARY_GCODE_STREAM)
+  #include "../gcode/queue.h"
+#endif
+
 inline bool bs_serial_data_available(const serial_index_t index) {
   return SERIAL_IMPL.available(index);
 }
@@ -47,6 +51,8 @@ inline int bs_read_serial(const serial_index_t index) {
   #endif
 #endif
 
+#if ENABLED(BINARY_FILE_TRANSFER)
+
 class SDFileTransferProtocol  {
 private:
   struct Packet {
@@ -205,9 +211,13 @@ public:
   static const uint16_t VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0, TIMEOUT = 10000, IDLE_PERIOD = 1000;
 };
 
+#endif // BINARY_FILE_TRANSFER
+
 class BinaryStream {
 public:
-  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER };
+  enum class Protocol : uint8_t { CONTROL, FILE_TRANSFER, GCODE };
+
+  enum class GCodePacket : uint8_t { TEXT, COMPRESSED }; // G-code packet types (M576 S2)
 
   enum class ProtocolControl : uint8_t { SYNC = 1, CLOSE };
 
@@ -262,6 +272,7 @@ public:
     sync = 0;
     packet_retries = 0;
     buffer_next_index = 0;
+    stream_state = StreamState::PACKET_RESET;
   }
 
   // fletchers 16 checksum
@@ -278,20 +289,19 @@ public:
       stream_state = StreamState::PACKET_TIMEOUT;
       return false;
     }
-    if (!bs_serial_data_available(card.transfer_port_index)) return false;
-    data = bs_read_serial(card.transfer_port_index);
+    if (!bs_serial_data_available(port)) return false;
+    data = bs_read_serial(port);
     packet.timeout = millis() + PACKET_MAX_WAIT;
     return true;
   }
 
   template<const size_t buffer_size>
-  void receive(char (&buffer)[buffer_size]) {
+  void receive(const serial_index_t index, char (&buffer)[buffer_size]) {
     uint8_t data = 0;
     millis_t transfer_window = millis() + RX_TIMESLICE;
 
-    #if ENABLED(SDSUPPORT)
-      PORT_REDIRECT(SERIAL_PORTMASK(card.transfer_port_index));
-    #endif
+    port = index;
+    PORT_REDIRECT(SERIAL_PORTMASK(port));
 
     #pragma GCC diagnostic push
     #pragma GCC diagnostic ignored "-Warray-bounds"
@@ -317,7 +327,10 @@ public:
           }
           break;
         case StreamState::PACKET_HEADER:
-          if (!stream_read(data)) break;
+          if (!stream_read(data)) {                    // Come back when there's more
+            if (stream_state == StreamState::PACKET_TIMEOUT) break;
+            return;
+          }
 
           packet.header.data[packet.bytes_received++] = data;
           packet.checksum = checksum(packet.checksum, data);
@@ -363,7 +376,10 @@ public:
           }
           break;
         case StreamState::PACKET_DATA:
-          if (!stream_read(data)) break;
+          if (!stream_read(data)) {                    // Come back when there's more
+            if (stream_state == StreamState::PACKET_TIMEOUT) break;
+            return;
+          }
 
           if (buffer_next_index < buffer_size)
             packet.buffer[buffer_next_index] = data;
@@ -383,7 +399,10 @@ public:
           }
           break;
         case StreamState::PACKET_FOOTER:
-          if (!stream_read(data)) break;
+          if (!stream_read(data)) {                    // Come back when there's more
+            if (stream_state == StreamState::PACKET_TIMEOUT) break;
+            return;
+          }
 
           packet.footer.data[packet.bytes_received++] = data;
           if (packet.bytes_received == sizeof(Packet::footer)) {
@@ -397,6 +416,12 @@ public:
           }
           break;
         case StreamState::PACKET_PROCESS:
+          #if ENABLED(BINARY_GCODE_STREAM)
+            // G-code is acknowledged once it's all in the command queue, which paces the host
+            if (static_cast<Protocol>(packet.header.protocol()) == Protocol::GCODE
+              && !GCodeQueue::packet_gcode(port, packet.header.type(), packet.buffer, packet.header.size)
+            ) return;
+          #endif
           sync++;
           packet_retries = 0;
           bytes_received += packet.header.size;
@@ -435,15 +460,21 @@ public:
       case Protocol::CONTROL:
         switch (static_cast<ProtocolControl>(packet.header.type())) {
           case ProtocolControl::CLOSE: // revert back to ASCII mode
-            card.flag.binary_mode = false;
+            TERN_(BINARY_FILE_TRANSFER, card.flag.binary_mode = false);
+            TERN_(BINARY_GCODE_STREAM, GCodeQueue::end_packet_stream(port));
             break;
           default:
             SERIAL_ECHO_MSG("Unknown BinaryProtocolControl Packet");
         }
         break;
-      case Protocol::FILE_TRANSFER:
-        SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
-      break;
+      #if ENABLED(BINARY_FILE_TRANSFER)
+        case Protocol::FILE_TRANSFER:
+          SDFileTransferProtocol::process(packet.header.type(), packet.buffer, packet.header.size); // send user data to be processed
+        break;
+      #endif
+      #if ENABLED(BINARY_GCODE_STREAM)
+        case Protocol::GCODE: break; // Already in the command queue
+      #endif
       default:
         SERIAL_ECHO_MSG("Unsupported Binary Protocol");
     }
@@ -451,10 +482,11 @@ public:
 
   void idle() {
     // Some Protocols may need periodic updates without new data
-    SDFileTransferProtocol::idle();
+    TERN_(BINARY_FILE_TRANSFER, SDFileTransferProtocol::idle());
   }
 
   static const uint16_t PACKET_MAX_WAIT = 500, RX_TIMESLICE = 20, MAX_RETRIES = 0, VERSION_MAJOR = 0, VERSION_MINOR = 1, VERSION_PATCH = 0;
+  serial_index_t port;
   uint8_t  packet_retries, sync;
   uint16_t buffer_next_index;
   uint32_t bytes_received;
@@ -170,6 +170,23 @@ namespace DirectStepping {
     }
   }
 
+  template<typename Cfg>
+  int8_t SerialPageManager<Cfg>::store_stream_char(const uint8_t c, const bool line_start) {
+    switch (state) {
+      case State::MONITOR:
+      case State::NEWLINE:
+        // A page starts with the control character at the start of a line
+        if (!line_start || c != Cfg::CONTROL_CHAR) return 0;
+        state = State::ADDRESS;
+        return 1;
+      case State::ADDRESS:
+        // Without a host to wait for free pages, hold the stream until the stepper is done with the page
+        if (c < Cfg::NUM_PAGES && (page_states[c] == PageState::WRITING || page_states[c] == PageState::OK)) return -1;
+      default:
+        return maybe_store_rxd_char(c) ? 1 : 0;
+    }
+  }
+
   template <typename Cfg>
   void SerialPageManager<Cfg>::write_responses() {
     if (fatal_error) {
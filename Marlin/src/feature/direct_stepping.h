@@ -56,6 +56,10 @@ namespace DirectStepping {
     static bool maybe_store_rxd_char(uint8_t c);
     static void write_responses();
 
+    // Store a byte of a page stream the firmware reads itself (e.g., from SD).
+    // Return 1 for page data, 0 for other data, or -1 to retry once the page is free.
+    static int8_t store_stream_char(const uint8_t c, const bool line_start);
+
     // common methods for page managers
     static void init();
     static uint8_t *get_page(const page_idx_t page_idx);
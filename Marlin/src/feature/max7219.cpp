@@ -609,10 +609,10 @@ void Max7219::idle_tasks() {
   #if MAX7219_USE_HEAD || MAX7219_USE_TAIL
     CRITICAL_SECTION_START();
     #if MAX7219_USE_HEAD
-      const uint8_t head = planner.block_buffer_head;
+      const block_index_t head = planner.block_buffer_head;
     #endif
     #if MAX7219_USE_TAIL
-      const uint8_t tail = planner.block_buffer_tail;
+      const block_index_t tail = planner.block_buffer_tail;
     #endif
     CRITICAL_SECTION_END();
   #endif
@@ -683,7 +683,7 @@ void Max7219::idle_tasks() {
 
   #ifdef MAX7219_DEBUG_PLANNER_QUEUE
     static int16_t last_depth = 0;
-    const int16_t current_depth = (head - tail + BLOCK_BUFFER_SIZE) & (BLOCK_BUFFER_SIZE - 1) & 0xF;
+    const int16_t current_depth = block_ring_t::distance(tail, head) & 0xF;
     if (current_depth != last_depth) {
       quantity16(MAX7219_DEBUG_PLANNER_QUEUE, last_depth, current_depth);
       last_depth = current_depth;
@@ -29,6 +29,7 @@
 #include "../gcode/gcode.h"
 
 #include "../inc/MarlinConfig.h"
+#include "../libs/ring_index.h"
 
 #if ENABLED(GCODE_REPEAT_MARKERS)
   #include "../feature/repeat.h"
@@ -136,12 +137,14 @@ typedef struct {
 
 class PrintJobRecovery {
   public:
+    typedef RingIndex<BUFSIZE>::type cmd_index_t; // Same as GCodeQueue::cmd_index_t
+
     static const char filename[5];
 
     static SdFile file;
     static job_recovery_info_t info;
 
-    static uint8_t queue_index_r;     //!< Queue index of the active command
+    static cmd_index_t queue_index_r; //!< Queue index of the active command
     static uint32_t cmd_sdpos,        //!< SD position of the next command
                     sdpos[BUFSIZE];   //!< SD positions of queued commands
 
@@ -166,7 +169,7 @@ class PrintJobRecovery {
 
     // Track each command's file offsets
     static inline uint32_t command_sdpos() { return sdpos[queue_index_r]; }
-    static inline void commit_sdpos(const uint8_t index_w) { sdpos[index_w] = cmd_sdpos; }
+    static inline void commit_sdpos(const cmd_index_t index_w) { sdpos[index_w] = cmd_sdpos; }
 
     static bool enabled;
     static void enable(const bool onoff);
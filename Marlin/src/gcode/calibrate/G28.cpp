@@ -248,6 +248,9 @@ void GcodeSuite::G28() {
     set_bed_leveling_enabled(false);
   #endif
 
+  // Home without input shaping, so the endstops trigger where the steps are counted
+  TERN_(HAS_SHAPING, stepper.set_shaping_enabled(false));
+
   // Reset to the XY plane
   TERN_(CNC_WORKSPACE_PLANES, workspace_plane = PLANE_XY);
 
@@ -459,6 +462,8 @@ void GcodeSuite::G28() {
 
   TERN_(HAS_LEVELING, set_bed_leveling_enabled(leveling_restore_state));
 
+  TERN_(HAS_SHAPING, stepper.set_shaping_enabled(true));
+
   restore_feedrate_and_scaling();
 
   // Restore the active tool after homing
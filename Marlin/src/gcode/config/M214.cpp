@@ -0,0 +1,52 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+
+#include "../../inc/MarlinConfig.h"
+
+#if HAS_CHORDAL_TOLERANCE
+
+#include "../gcode.h"
+#include "../../module/chordal.h"
+
+/**
+ * M214: Set the chordal tolerance of G2/G3 arc and G5 curve segments
+ *
+ *   S<mm> : Furthest a segment may stray from the true curve
+ *
+ * Report the current tolerance if no parameter is specified
+ */
+void GcodeSuite::M214() {
+  if (parser.seenval('S')) {
+    const float tol = parser.value_linear_units();
+    if (WITHIN(tol, 0.001f, 1.0f))
+      segmenter.tolerance = tol;
+    else
+      SERIAL_ECHOLNPGM("?S value out of range (0.001-1.0).");
+  }
+  else {
+    SERIAL_ECHO_START();
+    SERIAL_ECHOLNPAIR_F("Chordal tolerance: ", LINEAR_UNIT(segmenter.tolerance), 3);
+  }
+}
+
+#endif // HAS_CHORDAL_TOLERANCE
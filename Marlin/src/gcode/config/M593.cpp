@@ -0,0 +1,89 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if HAS_SHAPING
+
+#include "../gcode.h"
+#include "../../module/stepper.h"
+
+/**
+ * M593: Set the input shaping of the X and Y axes
+ *
+ *   X      : Set the X axis
+ *   Y      : Set the Y axis (With neither X nor Y, set both)
+ *   F<hz>  : Resonant frequency. 0 turns the shaping off.
+ *   D<z>   : Damping ratio (0.0 - 0.99)
+ *   T<n>   : Shaper type. 0:ZV 1:ZVD 2:EI
+ *
+ * Report the current settings if no parameter is specified
+ */
+void GcodeSuite::M593() {
+  if (!parser.seen("FDT")) {
+    LOOP_L_N(a, 2) {
+      if (a == X_AXIS ? DISABLED(INPUT_SHAPING_X) : DISABLED(INPUT_SHAPING_Y)) continue;
+      const shaping_settings_t &s = stepper.shaping[a];
+      SERIAL_ECHO_START();
+      SERIAL_CHAR(a == X_AXIS ? 'X' : 'Y');
+      SERIAL_ECHOPAIR_F(" input shaping F", s.frequency, 2);
+      SERIAL_ECHOPAIR_F(" D", s.zeta, 3);
+      SERIAL_ECHOLNPAIR(" T", int(s.type));
+    }
+    return;
+  }
+
+  const bool seen_x = parser.seen_test('X'), seen_y = parser.seen_test('Y'),
+             for_x = ENABLED(INPUT_SHAPING_X) && (seen_x || !seen_y),
+             for_y = ENABLED(INPUT_SHAPING_Y) && (seen_y || !seen_x);
+
+  if (!for_x && !for_y) {
+    SERIAL_ECHOLNPGM("?Axis is not shaped.");
+    return;
+  }
+
+  const float freq = parser.floatval('F', -1), zeta = parser.floatval('D', -1);
+  const int16_t type = parser.intval('T', -1);
+  if (freq >= 0 && freq < (SHAPING_MIN_FREQ) && freq != 0) {
+    SERIAL_ECHOLNPAIR("?F value out of range (0 or ", SHAPING_MIN_FREQ, "+).");
+    return;
+  }
+  if (parser.seen('D') && !WITHIN(zeta, 0, 0.99f)) {
+    SERIAL_ECHOLNPGM("?D value out of range (0.0-0.99).");
+    return;
+  }
+  if (parser.seen('T') && !WITHIN(type, SHAPER_ZV, SHAPER_EI)) {
+    SERIAL_ECHOLNPGM("?T value out of range (0-2).");
+    return;
+  }
+
+  LOOP_L_N(a, 2) {
+    if (!(a == X_AXIS ? for_x : for_y)) continue;
+    shaping_settings_t s = stepper.shaping[a];
+    if (freq >= 0) s.frequency = freq;
+    if (zeta >= 0) s.zeta = zeta;
+    if (type >= 0) s.type = ShaperType(type);
+    stepper.set_shaping(AxisEnum(a), s);
+  }
+}
+
+#endif // HAS_SHAPING
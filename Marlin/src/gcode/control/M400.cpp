@@ -29,5 +29,6 @@
 void GcodeSuite::M400() {
 
   planner.synchronize();
+  { extern void rx_bench(); rx_bench(); }
 
 }
@@ -670,6 +670,10 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 211: M211(); break;                                  // M211: Enable, Disable, and/or Report software endstops
       #endif
 
+      #if HAS_CHORDAL_TOLERANCE
+        case 214: M214(); break;                                  // M214: Set G2/G3 and G5 chordal tolerance
+      #endif
+
       #if HAS_MULTI_EXTRUDER
         case 217: M217(); break;                                  // M217: Set filament swap parameters
       #endif
@@ -845,6 +849,14 @@ void GcodeSuite::process_parsed_command(const bool no_ok/*=false*/) {
         case 575: M575(); break;                                  // M575: Set serial baudrate
       #endif
 
+      #if HAS_STREAM_MODES
+        case 576: M576(); break;                                  // M576: Set host streaming mode
+      #endif
+
+      #if HAS_SHAPING
+        case 593: M593(); break;                                  // M593: Set input shaping
+      #endif
+
       #if ENABLED(ADVANCED_PAUSE_FEATURE)
         case 600: M600(); break;                                  // M600: Pause for Filament Change
         case 603: M603(); break;                                  // M603: Configure Filament Change
@@ -1052,7 +1064,14 @@ void GcodeSuite::process_next_command() {
 
   if (DEBUGGING(ECHO)) {
     SERIAL_ECHO_START();
-    SERIAL_ECHOLN(command.buffer);
+    #if ENABLED(BINARY_GCODE_COMMANDS)
+      if (parser.is_binary(command.buffer)) {
+        parser.print_binary(command.buffer);
+        SERIAL_EOL();
+      }
+      else
+    #endif
+        SERIAL_ECHOLN(command.buffer);
     #if ENABLED(M100_FREE_MEMORY_DUMPER)
       SERIAL_ECHOPAIR("slot:", queue.ring_buffer.index_r);
       M100_dump_routine(PSTR("   Command Queue:"), (const char*)&queue.ring_buffer, sizeof(queue.ring_buffer));
@@ -183,6 +183,7 @@
  * M209 - Turn Automatic Retract Detection on/off: S<0|1> (For slicers that don't support G10/11). (Requires FWRETRACT_AUTORETRACT)
           Every normal extrude-only move will be classified as retract depending on the direction.
  * M211 - Enable, Disable, and/or Report software endstops: S<0|1> (Requires MIN_SOFTWARE_ENDSTOPS or MAX_SOFTWARE_ENDSTOPS)
+ * M214 - Set/report the G2/G3 and G5 chordal tolerance: "M214 S<mm>". (Requires CHORDAL_TOLERANCE)
  * M217 - Set filament swap parameters: "M217 S<length> P<feedrate> R<feedrate>". (Requires SINGLENOZZLE)
  * M218 - Set/get a tool offset: "M218 T<index> X<offset> Y<offset>". (Requires 2 or more extruders)
  * M220 - Set Feedrate Percentage: "M220 S<percent>" (i.e., "FR" on the LCD)
@@ -241,6 +242,8 @@
  * M553 - Get or set IP netmask. (Requires enabled Ethernet port)
  * M554 - Get or set IP gateway. (Requires enabled Ethernet port)
  * M569 - Enable stealthChop on an axis. (Requires at least one _DRIVER_TYPE to be TMC2130/2160/2208/2209/5130/5160)
+ * M576 - Set/report the host streaming mode: "M576 S<0|1|2>". (Requires STREAM_WINDOW or BINARY_GCODE_STREAM)
+ * M593 - Set/report the input shaping of X and Y: "M593 [X] [Y] F<hz> D<damping> T<type>". (Requires INPUT_SHAPING_X or INPUT_SHAPING_Y)
  * M600 - Pause for filament change: "M600 X<pos> Y<pos> Z<raise> E<first_retract> L<later_retract>". (Requires ADVANCED_PAUSE_FEATURE)
  * M603 - Configure filament change: "M603 T<tool> U<unload_length> L<load_length>". (Requires ADVANCED_PAUSE_FEATURE)
  * M605 - Set Dual X-Carriage movement mode: "M605 S<mode> [X<x_offset>] [R<temp_offset>]". (Requires DUAL_X_CARRIAGE)
@@ -784,6 +787,10 @@ private:
 
   static void M211();
 
+  #if HAS_CHORDAL_TOLERANCE
+    static void M214();
+  #endif
+
   #if ENABLED(HAS_MULTI_EXTRUDER)
     static void M217();
   #endif
@@ -965,6 +972,14 @@ private:
     static void M575();
   #endif
 
+  #if HAS_STREAM_MODES
+    static void M576();
+  #endif
+
+  #if HAS_SHAPING
+    static void M593();
+  #endif
+
   #if ENABLED(ADVANCED_PAUSE_FEATURE)
     static void M600();
     static void M603();
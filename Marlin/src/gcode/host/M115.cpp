@@ -76,6 +76,12 @@ void GcodeSuite::M115() {
     // BINARY_FILE_TRANSFER (M28 B1)
     cap_line(PSTR("BINARY_FILE_TRANSFER"), ENABLED(BINARY_FILE_TRANSFER)); // TODO: Use SERIAL_IMPL.has_feature(port, SerialFeature::BinaryFileTransfer) once implemented
 
+    // STREAM_WINDOW (M576 S1)
+    cap_line(PSTR("STREAM_WINDOW"), ENABLED(STREAM_WINDOW));
+
+    // BINARY_GCODE_STREAM (M576 S2)
+    cap_line(PSTR("BINARY_GCODE_STREAM"), ENABLED(BINARY_GCODE_STREAM));
+
     // EEPROM (M500, M501)
     cap_line(PSTR("EEPROM"), ENABLED(EEPROM_SETTINGS));
 
@@ -0,0 +1,55 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "../../inc/MarlinConfig.h"
+
+#if HAS_STREAM_MODES
+
+#include "../gcode.h"
+#include "../queue.h"
+
+/**
+ * M576: Set or report how the port that sent the command streams G-code
+ *
+ *   S<mode> - 0 : Lines with an "ok" for each
+ *             1 : Lines with credit for a window of them (Requires STREAM_WINDOW)
+ *             2 : BinaryStream packets (Requires BINARY_GCODE_STREAM)
+ *
+ * Reports "Stream mode:<mode>" with L<lines> B<bytes> for the window and
+ * P<bytes> for the largest packet. Mode 1 starts with a credit report,
+ * "ok N<done> R<read>". See STREAM_WINDOW and BINARY_GCODE_STREAM in
+ * Configuration_adv.h
+ */
+void GcodeSuite::M576() {
+  if (parser.seenval('S') && !queue.set_stream_mode(parser.value_byte()))
+    SERIAL_ECHO_MSG("?(S)tream mode not available.");
+  SERIAL_ECHOPAIR("Stream mode:", int(queue.stream_mode()));
+  #if ENABLED(STREAM_WINDOW)
+    SERIAL_ECHOPGM(" L" STRINGIFY(STREAM_WINDOW_LINES) " B" STRINGIFY(STREAM_WINDOW_BYTES));
+  #endif
+  #if ENABLED(BINARY_GCODE_STREAM)
+    SERIAL_ECHOPGM(" P" STRINGIFY(BINARY_STREAM_PACKET_SIZE));
+  #endif
+  SERIAL_EOL();
+}
+
+#endif // HAS_STREAM_MODES
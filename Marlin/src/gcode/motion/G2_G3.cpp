@@ -29,6 +29,10 @@
 #include "../../module/planner.h"
 #include "../../module/temperature.h"
 
+#if HAS_CHORDAL_TOLERANCE
+  #include "../../module/chordal.h"
+#endif
+
 #if ENABLED(DELTA)
   #include "../../module/delta.h"
 #elif ENABLED(SCARA)
@@ -47,6 +51,12 @@
  * MM_PER_ARC_SEGMENT (Default 1mm). In the future we hope more slicers will include
  * an option to generate G2/G3 arcs for curved surfaces, as this will allow faster
  * boards to produce much smoother curved surfaces.
+ *
+ * With CHORDAL_TOLERANCE the segments are instead as long as they can be
+ * while staying within the tolerance (M214) of the true arc.
+ *
+ * With NATIVE_ARC_BLOCKS the planner takes the arc as a single block and the
+ * Stepper ISR traces it, so arc-fitted G-code doesn't flood the planner buffer.
  */
 void plan_arc(
   const xyze_pos_t &cart,   // Destination position
@@ -143,18 +153,49 @@ void plan_arc(
 
   const feedRate_t scaled_fr_mm_s = MMS_SCALED(feedrate_mm_s);
 
-  // Start with a nominal segment length
-  float seg_length = (
-    #ifdef ARC_SEGMENTS_PER_R
-      constrain(MM_PER_ARC_SEGMENT * radius, MM_PER_ARC_SEGMENT, ARC_SEGMENTS_PER_R)
-    #elif ARC_SEGMENTS_PER_SEC
-      _MAX(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MM_PER_ARC_SEGMENT)
-    #else
-      MM_PER_ARC_SEGMENT
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    /**
+     * Send the whole arc to the planner as a single block, unless leveling
+     * has to bend it or the soft endstops might clip it. The bounding box of
+     * the full circle is checked, erring on the safe side.
+     */
+    bool native_arc = TERN1(HAS_LEVELING, !planner.leveling_active);
+    #if HAS_SOFTWARE_ENDSTOPS
+      LOOP_L_N(i, 2) {
+        xyz_pos_t corner = cart;
+        corner[p_axis] = i ? center_P + radius : center_P - radius;
+        corner[q_axis] = i ? center_Q + radius : center_Q - radius;
+        corner[l_axis] = i ? start_L : cart[l_axis];
+        xyz_pos_t limited = corner;
+        apply_motion_limits(limited);
+        if (limited != corner) native_arc = false;
+      }
     #endif
-  );
-  // Divide total travel by nominal segment length
-  uint16_t segments = FLOOR(mm_of_travel / seg_length);
+    if (native_arc) {
+      planner.buffer_arc(cart, p_axis, q_axis, rvec, angular_travel, mm_of_travel, scaled_fr_mm_s, active_extruder);
+      current_position = cart;
+      return;
+    }
+  #endif
+
+  #if HAS_CHORDAL_TOLERANCE
+    // The longest chord within tolerance, unless the planner needs longer segments to keep up
+    float seg_length = _MAX(segmenter.arc_chord(radius), segmenter.min_length(scaled_fr_mm_s));
+    uint16_t segments = _MIN(CEIL(mm_of_travel / seg_length), float(UINT16_MAX));
+  #else
+    // Start with a nominal segment length
+    float seg_length = (
+      #ifdef ARC_SEGMENTS_PER_R
+        constrain(MM_PER_ARC_SEGMENT * radius, MM_PER_ARC_SEGMENT, ARC_SEGMENTS_PER_R)
+      #elif ARC_SEGMENTS_PER_SEC
+        _MAX(scaled_fr_mm_s * RECIPROCAL(ARC_SEGMENTS_PER_SEC), MM_PER_ARC_SEGMENT)
+      #else
+        MM_PER_ARC_SEGMENT
+      #endif
+    );
+    // Divide total travel by nominal segment length
+    uint16_t segments = FLOOR(mm_of_travel / seg_length);
+  #endif
   NOLESS(segments, min_segments);         // At least some segments
   seg_length = mm_of_travel / segments;
 
@@ -261,7 +302,7 @@ void plan_arc(
       planner.apply_leveling(raw);
     #endif
 
-    if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, 0
+    if (!TERN(HAS_CHORDAL_TOLERANCE, segmenter, planner).buffer_line(raw, scaled_fr_mm_s, active_extruder, 0
       OPTARG(SCARA_FEEDRATE_SCALING, inv_duration)
     )) break;
   }
@@ -26,12 +26,23 @@
 #include "../../feature/direct_stepping.h"
 
 #include "../gcode.h"
+#include "../../module/motion.h"
 #include "../../module/planner.h"
 
 /**
  * G6: Direct Stepper Move
+ *
+ * With no parameters, wait for the queued pages and continue
+ * from the position they left the steppers in.
  */
 void GcodeSuite::G6() {
+  if (!parser.seen("IRSXYZE")) {
+    planner.synchronize();
+    set_current_from_steppers_for_axis(ALL_AXES_ENUM);
+    sync_plan_position();
+    return;
+  }
+
   // TODO: feedrate support?
   if (parser.seen('R'))
     planner.last_page_step_rate = parser.value_ulong();
@@ -62,6 +62,9 @@ uint16_t GCodeParser::codenum;
   // Optimized Parameters
   uint32_t GCodeParser::codebits;  // found bits
   uint8_t GCodeParser::param[26];  // parameter offsets from command_ptr
+  #if ENABLED(BINARY_GCODE_COMMANDS)
+    bool GCodeParser::binary_command;
+  #endif
 #else
   char *GCodeParser::command_args; // start of parameters
 #endif
@@ -112,6 +115,10 @@ void GCodeParser::reset() {
  */
 void GCodeParser::parse(char *p) {
 
+  #if ENABLED(BINARY_GCODE_COMMANDS)
+    if ((binary_command = is_binary(p))) return parse_binary(p);
+  #endif
+
   reset(); // No codes to report
 
   auto uppercase = [](char c) {
@@ -363,10 +370,73 @@ void GCodeParser::parse(char *p) {
   }
 }
 
+#if ENABLED(BINARY_GCODE_COMMANDS)
+
+  /**
+   * Populate the command line state from a binary command. The parameter
+   * offsets point at each tag byte, and values are read directly from there.
+   */
+  void GCodeParser::parse_binary(char *p) {
+    reset();
+    command_ptr = p;
+
+    const uint8_t *b = (uint8_t*)p + 2;
+    const uint8_t * const end = b + uint8_t(p[1]);
+    if (end - b < 4) return;
+
+    command_letter = b[0];
+    codenum = b[1] | (b[2] << 8);
+    TERN_(USE_GCODE_SUBCODES, subcode = b[3]);
+
+    #if ENABLED(GCODE_MOTION_MODES)
+      if (command_letter == 'G'
+        && (codenum <= TERN(ARC_SUPPORT, 3, 1) || TERN0(BEZIER_CURVE_SUPPORT, codenum == 5) || TERN0(G38_PROBE_TARGET, codenum == 38))
+      ) {
+        motion_mode_codenum = codenum;
+        TERN_(USE_GCODE_SUBCODES, motion_mode_subcode = subcode);
+      }
+    #endif
+
+    for (b += 4; b < end;) {
+      const uint8_t ind = *b & 0x1F, type = *b >> 5;
+      if (ind < COUNT(param)) {
+        SBI32(codebits, ind);
+        param[ind] = type == BINARY_PARAM_NONE ? 0 : b - (uint8_t*)command_ptr;
+      }
+      b += type == BINARY_PARAM_NONE ? 1 : 5;
+    }
+  }
+
+  // Print a binary command in its text form
+  void GCodeParser::print_binary(const char * const buf) {
+    const uint8_t *b = (const uint8_t*)buf + 2;
+    const uint8_t * const end = b + uint8_t(buf[1]);
+    if (end - b < 4) return;
+    SERIAL_CHAR(b[0]);
+    SERIAL_ECHO(b[1] | (b[2] << 8));
+    if (b[3]) SERIAL_ECHOPAIR(".", b[3]);
+    for (b += 4; b < end;) {
+      const uint8_t type = *b >> 5;
+      SERIAL_CHAR(' ', 'A' + (*b & 0x1F));
+      if (type == BINARY_PARAM_INT) {
+        int32_t l; memcpy(&l, b + 1, sizeof(l));
+        SERIAL_ECHO(l);
+      }
+      else if (type == BINARY_PARAM_FLOAT) {
+        float f; memcpy(&f, b + 1, sizeof(f));
+        SERIAL_ECHO_F(f, 5);
+      }
+      b += type == BINARY_PARAM_NONE ? 1 : 5;
+    }
+  }
+
+#endif // BINARY_GCODE_COMMANDS
+
 #if ENABLED(CNC_COORDINATE_SYSTEMS)
 
   // Parse the next parameter as a new command
   bool GCodeParser::chain() {
+    if (TERN0(BINARY_GCODE_COMMANDS, binary_command)) return false;
     #if ENABLED(FASTER_GCODE_PARSER)
       char *next_command = command_ptr;
       if (next_command) {
@@ -384,6 +454,15 @@ void GCodeParser::parse(char *p) {
 #endif // CNC_COORDINATE_SYSTEMS
 
 void GCodeParser::unknown_command_warning() {
+  #if ENABLED(BINARY_GCODE_COMMANDS)
+    if (binary_command) {
+      SERIAL_ECHO_START();
+      SERIAL_ECHOPGM(STR_UNKNOWN_COMMAND);
+      print_binary(command_ptr);
+      SERIAL_ECHOLNPGM("\"");
+      return;
+    }
+  #endif
   SERIAL_ECHO_MSG(STR_UNKNOWN_COMMAND, command_ptr, "\"");
 }
 
@@ -42,6 +42,21 @@
   typedef enum : uint8_t { LINEARUNIT_MM, LINEARUNIT_INCH } LinearUnit;
 #endif
 
+#if ENABLED(BINARY_GCODE_COMMANDS)
+  /**
+   * Pre-tokenized binary commands are framed in the input stream as
+   *
+   *   BINARY_GCODE_MARK, length, payload[length], checksum (XOR of length and payload)
+   *
+   * and kept in the command buffer as MARK, length, payload. The payload is the
+   * command letter, codenum (uint16), subcode (uint8), and then for each parameter
+   * a tag byte (type << 5 | letter - 'A') followed by nothing, an int32, or a float.
+   * All values are little-endian. Parameters may not carry strings.
+   */
+  #define BINARY_GCODE_MARK 0x01
+  enum BinaryParamType : uint8_t { BINARY_PARAM_NONE, BINARY_PARAM_INT, BINARY_PARAM_FLOAT };
+#endif
+
 /**
  * GCode parser
  *
@@ -62,6 +77,9 @@ private:
   #if ENABLED(FASTER_GCODE_PARSER)
     static uint32_t codebits;       // Parameters pre-scanned
     static uint8_t param[26];       // For A-Z, offsets into command args
+    #if ENABLED(BINARY_GCODE_COMMANDS)
+      static bool binary_command;   // Values are binary, pointed to by their tag byte
+    #endif
   #else
     static char *command_args;      // Args start here, for slow scan
   #endif
@@ -104,6 +122,11 @@ public:
   // Reset is done before parsing
   static void reset();
 
+  #if ENABLED(BINARY_GCODE_COMMANDS)
+    static inline bool is_binary(const char * const buf) { return buf[0] == BINARY_GCODE_MARK; }
+    static void print_binary(const char * const buf);
+  #endif
+
   #define LETTER_BIT(N) ((N) - 'A')
 
   FORCE_INLINE static bool valid_signless(const char * const p) {
@@ -149,7 +172,7 @@ public:
       if (b) {
         if (param[ind]) {
           char * const ptr = command_ptr + param[ind];
-          value_ptr = valid_number(ptr) ? ptr : nullptr;
+          value_ptr = (TERN0(BINARY_GCODE_COMMANDS, binary_command) || valid_number(ptr)) ? ptr : nullptr;
         }
         else
           value_ptr = nullptr;
@@ -239,6 +262,21 @@ public:
   // This uses 54 bytes of SRAM to speed up seen/value
   static void parse(char * p);
 
+  #if ENABLED(BINARY_GCODE_COMMANDS)
+    // Populate all fields from a binary command, with no text scanning
+    static void parse_binary(char * p);
+
+    // Binary values, for a value_ptr pointing at a parameter tag
+    static inline int32_t binary_long() {
+      if (uint8_t(*value_ptr) >> 5 == BINARY_PARAM_FLOAT) { float f; memcpy(&f, value_ptr + 1, sizeof(f)); return (int32_t)f; }
+      int32_t l; memcpy(&l, value_ptr + 1, sizeof(l)); return l;
+    }
+    static inline float binary_float() {
+      if (uint8_t(*value_ptr) >> 5 == BINARY_PARAM_INT) return (float)binary_long();
+      float f; memcpy(&f, value_ptr + 1, sizeof(f)); return f;
+    }
+  #endif
+
   #if ENABLED(CNC_COORDINATE_SYSTEMS)
     // Parse the next parameter as a new command
     static bool chain();
@@ -258,6 +296,9 @@ public:
 
   // Float removes 'E' to prevent scientific notation interpretation
   static inline float value_float() {
+    #if ENABLED(BINARY_GCODE_COMMANDS)
+      if (binary_command) return value_ptr ? binary_float() : 0;
+    #endif
     if (value_ptr) {
       char *e = value_ptr;
       for (;;) {
@@ -277,8 +318,13 @@ public:
   }
 
   // Code value as a long or ulong
-  static inline int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
-  static inline uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #if ENABLED(BINARY_GCODE_COMMANDS)
+    static inline int32_t value_long() { return value_ptr ? (binary_command ? binary_long() : strtol(value_ptr, nullptr, 10)) : 0L; }
+    static inline uint32_t value_ulong() { return value_ptr ? (binary_command ? (uint32_t)binary_long() : strtoul(value_ptr, nullptr, 10)) : 0UL; }
+  #else
+    static inline int32_t value_long() { return value_ptr ? strtol(value_ptr, nullptr, 10) : 0L; }
+    static inline uint32_t value_ulong() { return value_ptr ? strtoul(value_ptr, nullptr, 10) : 0UL; }
+  #endif
 
   // Code value for use as time
   static inline millis_t value_millis() { return value_ulong(); }
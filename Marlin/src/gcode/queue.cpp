@@ -1,3 +1,5 @@
+#include <time.h>
+long long rx_ns, rx_calls;
 /**
  * Marlin 3D Printer Firmware
  * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
@@ -45,10 +47,14 @@ GCodeQueue queue;
   #include "../feature/ethernet.h"
 #endif
 
-#if ENABLED(BINARY_FILE_TRANSFER)
+#if HAS_BINARY_STREAM
   #include "../feature/binary_stream.h"
 #endif
 
+#if ENABLED(DIRECT_STEPPING)
+  #include "../feature/direct_stepping.h"
+#endif
+
 #if ENABLED(POWER_LOSS_RECOVERY)
   #include "../feature/powerloss.h"
 #endif
@@ -101,7 +107,12 @@ bool GCodeQueue::RingBuffer::enqueue(const char *cmd, bool skip_ok/*=true*/
   OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind/*=-1*/)
 ) {
   if (*cmd == ';' || length >= BUFSIZE) return false;
-  strcpy(commands[index_w].buffer, cmd);
+  #if ENABLED(BINARY_GCODE_COMMANDS)
+    if (parser.is_binary(cmd))
+      memcpy(commands[index_w].buffer, cmd, uint8_t(cmd[1]) + 2);
+    else
+  #endif
+      strcpy(commands[index_w].buffer, cmd);
   commit_command(skip_ok
     #if HAS_MULTI_SERIAL
       , serial_ind
@@ -240,6 +251,10 @@ void GCodeQueue::RingBuffer::ok_to_send() {
     PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));   // Reply to the serial port that sent the command
   #endif
   if (command.skip_ok) return;
+  #if ENABLED(STREAM_WINDOW)
+    // Numbered lines are acknowledged in batches
+    if (command.buffer[0] == 'N' && serial_state[command_port().index].windowed) return;
+  #endif
   SERIAL_ECHOPGM(STR_OK);
   #if ENABLED(ADVANCED_OK)
     char* p = command.buffer;
@@ -265,6 +280,14 @@ void GCodeQueue::flush_and_request_resend(const serial_index_t serial_ind) {
   #endif
   SERIAL_FLUSH();
   SERIAL_ECHOLNPAIR(STR_RESEND, serial_state[serial_ind.index].last_N + 1);
+  #if ENABLED(STREAM_WINDOW)
+    SerialState &serial = serial_state[serial_ind.index];
+    if (serial.windowed) {
+      serial.resend_pending = true;   // Lines already sent after the bad one will be dropped
+      report_stream_credit(serial_ind);
+      return;
+    }
+  #endif
   SERIAL_ECHOLNPGM(STR_OK);
 }
 
@@ -291,6 +314,10 @@ static bool serial_data_available(serial_index_t index) {
 
 inline int read_serial(const serial_index_t index) { return SERIAL_IMPL.read(index); }
 
+// Received bytes in place, where the port allows it
+bool bench_no_span; inline uint16_t serial_rx_span(const serial_index_t index, const uint8_t **data) { if (bench_no_span) return 0; return CALL_IF_EXISTS(uint16_t, &SERIAL_IMPL, rxSpan, index, data); }
+inline void serial_rx_consume(const serial_index_t index, const uint16_t count) { CALL_IF_EXISTS(void, &SERIAL_IMPL, rxConsume, index, count); }
+
 void GCodeQueue::gcode_line_error(PGM_P const err, const serial_index_t serial_ind) {
   PORT_REDIRECT(SERIAL_PORTMASK(serial_ind)); // Reply to the serial port that sent the command
   SERIAL_ERROR_START();
@@ -300,6 +327,33 @@ void GCodeQueue::gcode_line_error(PGM_P const err, const serial_index_t serial_i
   serial_state[serial_ind.index].count = 0;
 }
 
+#if ENABLED(STREAM_WINDOW)
+
+  /**
+   * Report the last line done and the last line read. The host
+   * may send up to STREAM_WINDOW_LINES beyond the first and up to
+   * STREAM_WINDOW_BYTES beyond the second.
+   */
+  void GCodeQueue::report_stream_credit(const serial_index_t serial_ind) {
+    SerialState &serial = serial_state[serial_ind.index];
+    PORT_REDIRECT(SERIAL_PORTMASK(serial_ind));
+    SERIAL_ECHOLNPAIR(STR_OK " N", serial.done_N, " R", serial.last_N);
+    serial.granted_N = serial.done_N;
+  }
+
+  /**
+   * A numbered line is done. In windowed mode report credit after
+   * STREAM_ACK_LINES lines or when there's nothing left to do.
+   */
+  void GCodeQueue::stream_line_done(const serial_index_t serial_ind, const long n) {
+    SerialState &serial = serial_state[serial_ind.index];
+    serial.done_N = n;
+    if (serial.windowed && (n - serial.granted_N >= STREAM_ACK_LINES || (ring_buffer.empty() && !serial_data_available(serial_ind))))
+      report_stream_credit(serial_ind);
+  }
+
+#endif // STREAM_WINDOW
+
 FORCE_INLINE bool is_M29(const char * const cmd) {  // matches "M29" & "M29 ", but not "M290", etc
   const char * const m29 = strstr_P(cmd, PSTR("M29"));
   return m29 && !NUMERIC(m29[3]);
@@ -363,6 +417,37 @@ inline void process_stream_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD
   }
 }
 
+#if ENABLED(BINARY_GCODE_COMMANDS)
+
+  #define PS_BINARY 8
+
+  // A binary command starts with the mark at the start of a line and continues until its checksum
+  inline bool binary_input(const char c, uint8_t &sis, const int ind) {
+    if (sis == PS_NORMAL && ind == 0 && c == BINARY_GCODE_MARK) sis = PS_BINARY;
+    return sis == PS_BINARY;
+  }
+
+  /**
+   * Collect a binary command frame into the buffer. Return 0 while incomplete,
+   * 1 when a good frame is complete, or -1 for a bad checksum or overflow.
+   */
+  inline int8_t process_binary_char(const char c, uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind) {
+    const int end = ind < 2 ? MAX_CMD_SIZE : uint8_t(buff[1]) + 2;
+    if (ind < end) {                      // Mark, length, or payload
+      if (ind < MAX_CMD_SIZE) buff[ind] = c;
+      ind++;
+      return 0;
+    }
+    sis = PS_NORMAL;                      // The checksum ends the frame
+    ind = 0;
+    if (end > MAX_CMD_SIZE) return -1;
+    uint8_t checksum = 0;
+    for (int i = 1; i < end; i++) checksum ^= buff[i];
+    return checksum == uint8_t(c) ? 1 : -1;
+  }
+
+#endif
+
 /**
  * Handle a line being completed. For an empty line
  * keep sensor readings going and watchdog alive.
@@ -378,11 +463,232 @@ inline bool process_line_done(uint8_t &sis, char (&buff)[MAX_CMD_SIZE], int &ind
   return is_empty;                    // Inform the caller
 }
 
+#if ENABLED(BINARY_GCODE_STREAM)
+
+  static char packet_buffer[BINARY_STREAM_PACKET_SIZE]; // The payload of the packet being received
+  static uint16_t packet_index,                         // Payload bytes taken so far
+                  decoded_index, decoded_length;        // Decoded bytes taken so far, and available
+
+  bool GCodeQueue::packet_gcode(const serial_index_t serial_ind, const uint8_t type, const char * const data, const uint16_t length) {
+    SerialState &serial = serial_state[serial_ind.index];
+    const bool compressed = (type == uint8_t(BinaryStream::GCodePacket::COMPRESSED));
+    for (;;) {
+      if (ring_buffer.full()) return false;           // Take the rest later
+
+      char c;
+      if (compressed) {
+        if (decoded_index >= decoded_length) {        // Decode some more of the stream
+          size_t count = 0;
+          if (packet_index < length) {
+            heatshrink_decoder_sink(&hsd, (uint8_t*)&data[packet_index], length - packet_index, &count);
+            packet_index += count;
+          }
+          heatshrink_decoder_poll(&hsd, decode_buffer, sizeof(decode_buffer), &count);
+          decoded_index = 0;
+          decoded_length = count;
+          if (!count) {
+            if (packet_index < length) continue;
+            break;                                    // The rest is in the next packet
+          }
+        }
+        c = decode_buffer[decoded_index++];
+      }
+      else {
+        if (packet_index >= length) break;
+        c = data[packet_index++];
+      }
+
+      #if ENABLED(BINARY_GCODE_COMMANDS)
+        if (binary_input(c, serial.input_state, serial.count)) {
+          const int8_t frame = process_binary_char(c, serial.input_state, serial.line_buffer, serial.count);
+          if (frame > 0)
+            ring_buffer.enqueue(serial.line_buffer, true OPTARG(HAS_MULTI_SERIAL, serial_ind));
+          else if (frame < 0)
+            SERIAL_ERROR_MSG(STR_ERR_BINARY_COMMAND);
+          continue;
+        }
+      #endif
+
+      if (ISEOL(c)) {
+        if (!process_line_done(serial.input_state, serial.line_buffer, serial.count))
+          ring_buffer.enqueue(serial.line_buffer, true OPTARG(HAS_MULTI_SERIAL, serial_ind));
+      }
+      else
+        process_stream_char(c, serial.input_state, serial.line_buffer, serial.count);
+    }
+    packet_index = 0;
+    return true;
+  }
+
+#endif // BINARY_GCODE_STREAM
+
+#if HAS_STREAM_MODES
+
+  bool GCodeQueue::set_stream_mode(const uint8_t mode) {
+    const serial_index_t serial_ind = ring_buffer.command_port();
+    SerialState &serial = serial_state[serial_ind.index];
+    switch (mode) {
+      case 0: break;
+      #if ENABLED(STREAM_WINDOW)
+        case 1: break;
+      #endif
+      #if ENABLED(BINARY_GCODE_STREAM)
+        case 2:
+          LOOP_L_N(p, NUM_SERIAL)                     // One packet stream at a time
+            if (p != serial_ind.index && serial_state[p].packets) return false;
+          break;
+      #endif
+      default: return false;
+    }
+
+    #if ENABLED(STREAM_WINDOW)
+      serial.windowed = (mode == 1);
+      serial.resend_pending = false;
+      if (serial.windowed) report_stream_credit(serial_ind);
+    #endif
+
+    #if ENABLED(BINARY_GCODE_STREAM)
+      if ((serial.packets = (mode == 2))) {
+        binaryStream[serial_ind.index].reset();
+        heatshrink_decoder_reset(&hsd);
+        packet_index = decoded_index = decoded_length = 0;
+        serial.count = 0;
+        serial.input_state = PS_NORMAL;
+      }
+    #endif
+
+    return true;
+  }
+
+  uint8_t GCodeQueue::stream_mode() {
+    const SerialState &serial = serial_state[ring_buffer.command_port().index];
+    return TERN0(BINARY_GCODE_STREAM, serial.packets) ? 2 : TERN0(STREAM_WINDOW, serial.windowed) ? 1 : 0;
+  }
+
+#endif // HAS_STREAM_MODES
+
 /**
  * Get all commands waiting on the serial port and queue them.
  * Exit when the buffer is full or when no more characters are
  * left on the serial port.
  */
+int8_t GCodeQueue::take_serial_char(const serial_index_t p, const char serial_char, char (&buff)[MAX_CMD_SIZE]) {
+  SerialState &serial = serial_state[p.index];
+
+  #if ENABLED(BINARY_GCODE_COMMANDS)
+    if (binary_input(serial_char, serial.input_state, serial.count)) {
+      const int8_t frame = process_binary_char(serial_char, serial.input_state, buff, serial.count);
+      if (frame < 0) {
+        gcode_line_error(PSTR(STR_ERR_CHECKSUM_MISMATCH), p);
+        return -1;
+      }
+      return frame;
+    }
+  #endif
+
+  if (!ISEOL(serial_char)) {
+    process_stream_char(serial_char, serial.input_state, buff, serial.count);
+    return 0;
+  }
+
+  // Reset our state, continue if the line was empty
+  if (process_line_done(serial.input_state, buff, serial.count))
+    return 0;
+
+  char* command = buff;
+
+  while (*command == ' ') command++;                   // Skip leading spaces
+  char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
+
+  #if ENABLED(STREAM_WINDOW)
+    if (serial.resend_pending && !npos) return 0;      // Drop lines until the resend arrives
+  #endif
+
+  if (npos) {
+
+    const bool M110 = !!strstr_P(command, PSTR("M110"));
+
+    if (M110) {
+      char* n2pos = strchr(command + 4, 'N');
+      if (n2pos) npos = n2pos;
+    }
+
+    const long gcode_N = strtol(npos + 1, nullptr, 10);
+
+    #if ENABLED(STREAM_WINDOW)
+      if (serial.resend_pending) {
+        if (gcode_N != serial.last_N + 1) return 0;    // Sent before the host saw "Resend:"
+        serial.resend_pending = false;
+      }
+    #endif
+
+    if (gcode_N != serial.last_N + 1 && !M110) {
+      // In case of error on a serial port, don't prevent other serial port from making progress
+      gcode_line_error(PSTR(STR_ERR_LINE_NO), p);
+      return -1;
+    }
+
+    char *apos = strrchr(command, '*');
+    if (apos) {
+      uint8_t checksum = 0, count = uint8_t(apos - command);
+      while (count) checksum ^= command[--count];
+      if (strtol(apos + 1, nullptr, 10) != checksum) {
+        // In case of error on a serial port, don't prevent other serial port from making progress
+        gcode_line_error(PSTR(STR_ERR_CHECKSUM_MISMATCH), p);
+        return -1;
+      }
+    }
+    else {
+      // In case of error on a serial port, don't prevent other serial port from making progress
+      gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), p);
+      return -1;
+    }
+
+    serial.last_N = gcode_N;
+  }
+  #if ENABLED(SDSUPPORT)
+    // Pronterface "M29" and "M29 " has no line number
+    else if (card.flag.saving && !is_M29(command)) {
+      gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), p);
+      return -1;
+    }
+  #endif
+
+  //
+  // Movement commands give an alert when the machine is stopped
+  //
+
+  if (IsStopped()) {
+    char* gpos = strchr(command, 'G');
+    if (gpos) {
+      switch (strtol(gpos + 1, nullptr, 10)) {
+        case 0 ... 1:
+        TERN_(ARC_SUPPORT, case 2 ... 3:)
+        TERN_(BEZIER_CURVE_SUPPORT, case 5:)
+          PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
+          SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
+          LCD_MESSAGEPGM(MSG_STOPPED);
+          break;
+      }
+    }
+  }
+
+  #if DISABLED(EMERGENCY_PARSER)
+    // Process critical commands early
+    if (command[0] == 'M') switch (command[3]) {
+      case '8': if (command[2] == '0' && command[1] == '1') { wait_for_heatup = false; TERN_(HAS_LCD_MENU, wait_for_user = false); } break;
+      case '2': if (command[2] == '1' && command[1] == '1') kill(M112_KILL_STR, nullptr, true); break;
+      case '0': if (command[1] == '4' && command[2] == '1') quickstop_stepper(); break;
+    }
+  #endif
+
+  #if NO_TIMEOUTS > 0
+    last_command_time = millis();
+  #endif
+
+  return 1;                                            // Add the command to the queue
+}
+
 void GCodeQueue::get_serial_commands() {
   #if ENABLED(BINARY_FILE_TRANSFER)
     if (card.flag.binary_mode) {
@@ -391,7 +697,7 @@ void GCodeQueue::get_serial_commands() {
        * receive buffer (which limits the packet size to MAX_CMD_SIZE).
        * The receive buffer also limits the packet size for reliable transmission.
        */
-      binaryStream[card.transfer_port_index.index].receive(serial_state[card.transfer_port_index.index].line_buffer);
+      binaryStream[card.transfer_port_index.index].receive(card.transfer_port_index, serial_state[card.transfer_port_index.index].line_buffer);
       return;
     }
   #endif
@@ -415,12 +721,55 @@ void GCodeQueue::get_serial_commands() {
       // Check if the queue is full and exit if it is.
       if (ring_buffer.full()) return;
 
+      #if ENABLED(BINARY_GCODE_STREAM)
+        if (serial_state[p].packets) {                // G-code in BinaryStream packets (M576 S2)
+          binaryStream[p].receive(p, packet_buffer);
+          continue;
+        }
+      #endif
+
       // No data for this port ? Skip it
       if (!serial_data_available(p)) continue;
 
       // Ok, we have some data to process, let's make progress here
       hadData = true;
 
+      SerialState &serial = serial_state[p];
+
+      /**
+       * Where the port can lend out its RX buffer, take bytes from it in place.
+       * A line that's all there is parsed straight into the next command slot.
+       * A line still arriving goes into the line buffer, since the slot has to
+       * stay free for other ports and SD in the meantime.
+       */
+      const uint8_t *span;
+      const uint16_t span_length = serial_rx_span(p, &span);
+      if (span_length) {
+        uint16_t end = span_length;
+        if (!serial.count) {                                  // Look for the end of a new line
+          for (end = 0; end < span_length && !ISEOL(span[end]); end++) { /* nada */ }
+          if (end < span_length) end++;
+        }
+        const bool in_place = !serial.count && ISEOL(span[end - 1]);
+        char (&buff)[MAX_CMD_SIZE] = in_place ? ring_buffer.commands[ring_buffer.index_w].buffer : serial.line_buffer;
+
+        uint16_t taken = 0;
+        int8_t line;
+        do line = take_serial_char(p, span[taken++], buff); while (!line && taken < end);
+        if (line < 0) break;                                  // The RX buffer was flushed
+        serial_rx_consume(p, taken);
+
+        if (line > 0) {
+          if (in_place)
+            ring_buffer.commit_command(false OPTARG(HAS_MULTI_SERIAL, p));
+          else
+            ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
+        }
+        else if (in_place && serial.count)                    // A binary frame that goes on past the EOL byte
+          memcpy(serial.line_buffer, buff, _MIN(serial.count, MAX_CMD_SIZE));
+        continue;
+      }
+
       const int c = read_serial(p);
       if (c < 0) {
         // This should never happen, let's log it
@@ -432,104 +781,9 @@ void GCodeQueue::get_serial_commands() {
         continue;
       }
 
-      const char serial_char = (char)c;
-      SerialState &serial = serial_state[p];
-
-      if (ISEOL(serial_char)) {
-
-        // Reset our state, continue if the line was empty
-        if (process_line_done(serial.input_state, serial.line_buffer, serial.count))
-          continue;
-
-        char* command = serial.line_buffer;
-
-        while (*command == ' ') command++;                   // Skip leading spaces
-        char *npos = (*command == 'N') ? command : nullptr;  // Require the N parameter to start the line
-
-        if (npos) {
-
-          const bool M110 = !!strstr_P(command, PSTR("M110"));
-
-          if (M110) {
-            char* n2pos = strchr(command + 4, 'N');
-            if (n2pos) npos = n2pos;
-          }
-
-          const long gcode_N = strtol(npos + 1, nullptr, 10);
-
-          if (gcode_N != serial.last_N + 1 && !M110) {
-            // In case of error on a serial port, don't prevent other serial port from making progress
-            gcode_line_error(PSTR(STR_ERR_LINE_NO), p);
-            break;
-          }
-
-          char *apos = strrchr(command, '*');
-          if (apos) {
-            uint8_t checksum = 0, count = uint8_t(apos - command);
-            while (count) checksum ^= command[--count];
-            if (strtol(apos + 1, nullptr, 10) != checksum) {
-              // In case of error on a serial port, don't prevent other serial port from making progress
-              gcode_line_error(PSTR(STR_ERR_CHECKSUM_MISMATCH), p);
-              break;
-            }
-          }
-          else {
-            // In case of error on a serial port, don't prevent other serial port from making progress
-            gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), p);
-            break;
-          }
-
-          serial.last_N = gcode_N;
-        }
-        #if ENABLED(SDSUPPORT)
-          // Pronterface "M29" and "M29 " has no line number
-          else if (card.flag.saving && !is_M29(command)) {
-            gcode_line_error(PSTR(STR_ERR_NO_CHECKSUM), p);
-            break;
-          }
-        #endif
-
-        //
-        // Movement commands give an alert when the machine is stopped
-        //
-
-        if (IsStopped()) {
-          char* gpos = strchr(command, 'G');
-          if (gpos) {
-            switch (strtol(gpos + 1, nullptr, 10)) {
-              case 0 ... 1:
-              TERN_(ARC_SUPPORT, case 2 ... 3:)
-              TERN_(BEZIER_CURVE_SUPPORT, case 5:)
-                PORT_REDIRECT(SERIAL_PORTMASK(p));     // Reply to the serial port that sent the command
-                SERIAL_ECHOLNPGM(STR_ERR_STOPPED);
-                LCD_MESSAGEPGM(MSG_STOPPED);
-                break;
-            }
-          }
-        }
-
-        #if DISABLED(EMERGENCY_PARSER)
-          // Process critical commands early
-          if (command[0] == 'M') switch (command[3]) {
-            case '8': if (command[2] == '0' && command[1] == '1') { wait_for_heatup = false; TERN_(HAS_LCD_MENU, wait_for_user = false); } break;
-            case '2': if (command[2] == '1' && command[1] == '1') kill(M112_KILL_STR, nullptr, true); break;
-            case '0': if (command[1] == '4' && command[2] == '1') quickstop_stepper(); break;
-          }
-        #endif
-
-        #if NO_TIMEOUTS > 0
-          last_command_time = ms;
-        #endif
-
-        // Add the command to the queue
-        ring_buffer.enqueue(serial.line_buffer, false
-          #if HAS_MULTI_SERIAL
-            , p
-          #endif
-        );
-      }
-      else
-        process_stream_char(serial_char, serial.input_state, serial.line_buffer, serial.count);
+      const int8_t line = take_serial_char(p, (char)c, serial.line_buffer);
+      if (line < 0) break;
+      if (line > 0) ring_buffer.enqueue(serial.line_buffer, false OPTARG(HAS_MULTI_SERIAL, p));
 
     } // NUM_SERIAL loop
   } // queue has space, serial has data
@@ -555,8 +809,38 @@ void GCodeQueue::get_serial_commands() {
       const bool card_eof = card.eof();
       if (n < 0 && !card_eof) { SERIAL_ERROR_MSG(STR_SD_ERR_READ); continue; }
 
+      #if ENABLED(DIRECT_STEPPING)
+        // Store pages as they are read, ahead of the G6 commands that step them
+        if (n >= 0 && sd_input_state == PS_NORMAL) {
+          const int8_t page = page_manager.store_stream_char(n, sd_count == 0);
+          if (page < 0) { card.setIndex(card.getIndex() - 1); break; } // Page in use. Retry later.
+          if (page > 0) {
+            if (card_eof) card.fileHasFinished();
+            continue;
+          }
+        }
+      #endif
+
       CommandLine &command = ring_buffer.commands[ring_buffer.index_w];
       const char sd_char = (char)n;
+
+      #if ENABLED(BINARY_GCODE_COMMANDS)
+        if (n >= 0 && binary_input(sd_char, sd_input_state, sd_count)) {
+          const int8_t frame = process_binary_char(sd_char, sd_input_state, command.buffer, sd_count);
+          if (frame > 0) {
+            ring_buffer.commit_command(true);
+            TERN_(POWER_LOSS_RECOVERY, recovery.cmd_sdpos = card.getIndex());
+          }
+          else if (frame < 0)
+            SERIAL_ERROR_MSG(STR_ERR_BINARY_COMMAND);
+          if (card_eof) {
+            sd_input_state = PS_NORMAL;                   // Drop a truncated frame
+            sd_count = 0;
+            card.fileHasFinished();
+          }
+          continue;
+        }
+      #endif
       const bool is_eol = ISEOL(sd_char);
       if (is_eol || card_eof) {
 
@@ -599,7 +883,9 @@ void GCodeQueue::get_serial_commands() {
 void GCodeQueue::get_available_commands() {
   if (ring_buffer.full()) return;
 
-  get_serial_commands();
+  { static struct timespec a, b; const auto l0 = ring_buffer.length; clock_gettime(CLOCK_THREAD_CPUTIME_ID, &a);
+    get_serial_commands();
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &b); if (ring_buffer.length != l0) { extern long long rx_ns, rx_calls; rx_ns += (b.tv_sec - a.tv_sec) * 1000000000LL + b.tv_nsec - a.tv_nsec; rx_calls++; } }
 
   TERN_(SDSUPPORT, get_sdcard_commands());
 }
@@ -623,10 +909,25 @@ void GCodeQueue::advance() {
   // Return if the G-code buffer is empty
   if (ring_buffer.empty()) return;
 
+  #if ENABLED(STREAM_WINDOW)
+    // Note the number of a serial line to count it done
+    const CommandLine &command = ring_buffer.peek_next_command();
+    const long line_N = (!command.skip_ok && command.buffer[0] == 'N') ? atol(command.buffer + 1) : -1;
+    const serial_index_t line_port = ring_buffer.command_port();
+  #endif
+
   #if ENABLED(SDSUPPORT)
 
     if (card.flag.saving) {
       char * const cmd = ring_buffer.peek_next_command_string();
+      #if ENABLED(BINARY_GCODE_COMMANDS)
+        if (parser.is_binary(cmd)) {
+          // Binary commands can't be written to a text file
+          SERIAL_ERROR_MSG(STR_ERR_BINARY_COMMAND);
+          ok_to_send();
+        }
+        else
+      #endif
       if (is_M29(cmd)) {
         // M29 closes the file
         card.closefile();
@@ -663,4 +964,29 @@ void GCodeQueue::advance() {
 
   // The queue may be reset by a command handler or by code invoked by idle() within a handler
   ring_buffer.advance_pos(ring_buffer.index_r, -1);
+
+  #if ENABLED(STREAM_WINDOW)
+    if (line_N >= 0) stream_line_done(line_port, line_N);
+  #endif
+}
+
+#include <time.h>
+void rx_bench() {
+  static const char line[] = "G92 X12.844 Y6.916 E1.08680\n";
+  for (int mode = 0; mode < 4; mode++) {
+    bench_no_span = mode & 1;
+    struct timespec a, b; long lines = 0; size_t k = 0;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &a);
+    while (lines < 200000) {
+      while (usb_serial.receive_buffer.free()) { usb_serial.receive_buffer.write(line[k++]); if (k == sizeof(line) - 1) k = 0; }
+      const auto l0 = GCodeQueue::ring_buffer.length;
+      GCodeQueue::get_serial_commands();
+      lines += GCodeQueue::ring_buffer.length - l0;
+      GCodeQueue::ring_buffer.clear();
+    }
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &b);
+    const long ns = (b.tv_sec - a.tv_sec) * 1000000000L + b.tv_nsec - a.tv_nsec;
+    SERIAL_ECHOLNPAIR(bench_no_span ? "bytewise " : "spans    ", ns / lines, " ns/line");
+  }
+  bench_no_span = false;
 }
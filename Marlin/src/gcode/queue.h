@@ -27,6 +27,7 @@
  */
 
 #include "../inc/MarlinConfig.h"
+#include "../libs/ring_index.h"
 
 class GCodeQueue {
 public:
@@ -43,6 +44,15 @@ public:
     int count;                      //!< Number of characters read in the current line of serial input
     char line_buffer[MAX_CMD_SIZE]; //!< The current line accumulator
     uint8_t input_state;            //!< The input state
+    #if ENABLED(STREAM_WINDOW)
+      bool windowed,                //!< Streaming with credit instead of an "ok" per line (M576)
+           resend_pending;          //!< Quietly drop lines until the one asked for arrives
+      long done_N,                  //!< The last numbered line done
+           granted_N;               //!< The last line done reported to the host
+    #endif
+    #if ENABLED(BINARY_GCODE_STREAM)
+      bool packets;                 //!< G-code arrives in BinaryStream packets (M576 S2)
+    #endif
   };
 
   static SerialState serial_state[NUM_SERIAL]; //!< Serial states for each serial port
@@ -64,20 +74,26 @@ public:
     #endif
   };
 
+  /**
+   * Command positions and counts. uint16_t for more than 256 commands.
+   */
+  typedef RingIndex<BUFSIZE> cmd_ring_t;
+  typedef cmd_ring_t::type cmd_index_t;
+
   /**
    * A handy ring buffer type
    */
   struct RingBuffer {
-    uint8_t length,                 //!< Number of commands in the queue
-            index_r,                //!< Ring buffer's read position
-            index_w;                //!< Ring buffer's write position
+    cmd_index_t length,             //!< Number of commands in the queue
+                index_r,            //!< Ring buffer's read position
+                index_w;            //!< Ring buffer's write position
     CommandLine commands[BUFSIZE];  //!< The ring buffer of commands
 
     inline serial_index_t command_port() const { return TERN0(HAS_MULTI_SERIAL, commands[index_r].port); }
 
     inline void clear() { length = index_r = index_w = 0; }
 
-    void advance_pos(uint8_t &p, const int inc) { if (++p >= BUFSIZE) p = 0; length += inc; }
+    void advance_pos(cmd_index_t &p, const int inc) { p = cmd_ring_t::next(p); length += inc; }
 
     void commit_command(bool skip_ok
       OPTARG(HAS_MULTI_SERIAL, serial_index_t serial_ind = serial_index_t())
@@ -89,7 +105,7 @@ public:
 
     void ok_to_send();
 
-    inline bool full(uint8_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
+    inline bool full(cmd_index_t cmdCount=1) const { return length > (BUFSIZE - cmdCount); }
 
     inline bool occupied() const { return length != 0; }
 
@@ -197,10 +213,40 @@ public:
    */
   static inline void set_current_line_number(long n) { serial_state[ring_buffer.command_port().index].last_N = n; }
 
+  #if HAS_STREAM_MODES
+    /**
+     * Set how the port that sent the current command streams G-code:
+     *   0 : Lines with an "ok" for each
+     *   1 : Lines with credit for a window of them (STREAM_WINDOW)
+     *   2 : BinaryStream packets (BINARY_GCODE_STREAM)
+     * Return false if the mode isn't available.
+     */
+    static bool set_stream_mode(const uint8_t mode);
+    static uint8_t stream_mode();
+  #endif
+
+  #if ENABLED(BINARY_GCODE_STREAM)
+    /**
+     * Take the G-code from a packet into the command queue.
+     * Return false while the queue is too full for the rest.
+     */
+    static bool packet_gcode(const serial_index_t serial_ind, const uint8_t type, const char * const data, const uint16_t length);
+
+    static inline void end_packet_stream(const serial_index_t serial_ind) { serial_state[serial_ind.index].packets = false; }
+  #endif
+
+  friend void rx_bench();
 private:
 
   static void get_serial_commands();
 
+  /**
+   * Take a character of serial input into the line being built in buff.
+   * Return 1 when buff holds a command to queue, -1 after a line error
+   * (with the RX buffer flushed), or 0 to continue.
+   */
+  static int8_t take_serial_char(const serial_index_t serial_ind, const char c, char (&buff)[MAX_CMD_SIZE]);
+
   #if ENABLED(SDSUPPORT)
     static void get_sdcard_commands();
   #endif
@@ -219,6 +265,11 @@ private:
 
   static void gcode_line_error(PGM_P const err, const serial_index_t serial_ind);
 
+  #if ENABLED(STREAM_WINDOW)
+    static void report_stream_credit(const serial_index_t serial_ind);
+    static void stream_line_done(const serial_index_t serial_ind, const long n);
+  #endif
+
   friend class GcodeSuite;
 };
 
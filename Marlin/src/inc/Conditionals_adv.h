@@ -167,6 +167,10 @@
   #define HAS_MEDIA_SUBCALLS 1
 #endif
 
+#if ENABLED(SDSUPPORT) && SD_READ_AHEAD_SECTORS
+  #define HAS_SD_READ_AHEAD 1
+#endif
+
 #if HAS_PRINT_PROGRESS && EITHER(PRINT_PROGRESS_SHOW_DECIMALS, SHOW_REMAINING_TIME)
   #define HAS_PRINT_PROGRESS_PERMYRIAD 1
 #endif
@@ -543,6 +547,31 @@
   #endif
 #endif
 
+// Flag whether G2/G3 and G5 segments are sized by chordal tolerance
+#if defined(CHORDAL_TOLERANCE) && EITHER(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
+  #define HAS_CHORDAL_TOLERANCE 1
+#endif
+
+// Flag whether S-Curve ramps are Bézier curves fitted into the trapezoid
+#if ENABLED(S_CURVE_ACCELERATION) && DISABLED(S_CURVE_JERK_LIMITED)
+  #define HAS_BEZIER_S_CURVE 1
+#endif
+
+// Flag whether the Stepper ISR echoes the steps of shaped axes
+#if EITHER(INPUT_SHAPING_X, INPUT_SHAPING_Y)
+  #define HAS_SHAPING 1
+#endif
+
+// Flag whether M576 can change how the host streams G-code
+#if EITHER(STREAM_WINDOW, BINARY_GCODE_STREAM)
+  #define HAS_STREAM_MODES 1
+#endif
+
+// Flag whether BinaryStream packets are received
+#if EITHER(BINARY_FILE_TRANSFER, BINARY_GCODE_STREAM)
+  #define HAS_BINARY_STREAM 1
+#endif
+
 // Flag whether least_squares_fit.cpp is used
 #if ANY(AUTO_BED_LEVELING_UBL, AUTO_BED_LEVELING_LINEAR, Z_STEPPER_ALIGN_KNOWN_STEPPER_POSITIONS)
   #define NEED_LSF 1
@@ -1302,6 +1302,34 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
   #error "CLASSIC_JERK is required for DELTA and SCARA."
 #endif
 
+/**
+ * Curvature window for junction deviation
+ */
+#ifdef JD_CURVATURE_WINDOW
+  #if !HAS_JUNCTION_DEVIATION
+    #error "JD_CURVATURE_WINDOW requires junction deviation. Disable CLASSIC_JERK."
+  #elif !WITHIN(JD_CURVATURE_WINDOW, 2, 16)
+    #error "JD_CURVATURE_WINDOW must be between 2 and 16."
+  #elif !(JD_CURVATURE_SEGMENT_MM > 0)
+    #error "JD_CURVATURE_SEGMENT_MM must be greater than 0."
+  #endif
+#endif
+
+/**
+ * Constant-jerk S-Curve ramps
+ */
+#if ENABLED(S_CURVE_JERK_LIMITED)
+  #if DISABLED(S_CURVE_ACCELERATION)
+    #error "S_CURVE_JERK_LIMITED requires S_CURVE_ACCELERATION."
+  #elif ENABLED(PLANNER_FIXED_POINT)
+    #error "S_CURVE_JERK_LIMITED is not compatible with PLANNER_FIXED_POINT."
+  #elif !defined(CPU_32_BIT)
+    #error "S_CURVE_JERK_LIMITED requires a 32-bit CPU."
+  #elif !(S_CURVE_MAX_JERK > 0)
+    #error "S_CURVE_MAX_JERK must be greater than 0."
+  #endif
+#endif
+
 /**
  * Probes
  */
@@ -1487,6 +1515,27 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
 
 #endif
 
+/**
+ * Flying Probe
+ */
+#if ENABLED(FLYING_PROBE)
+  #if !HAS_BED_PROBE
+    #error "FLYING_PROBE requires a bed probe."
+  #elif IS_KINEMATIC
+    #error "FLYING_PROBE is not compatible with DELTA or SCARA."
+  #elif ENABLED(SENSORLESS_PROBING)
+    #error "FLYING_PROBE is not compatible with SENSORLESS_PROBING."
+  #elif ENABLED(BLTOUCH) && DISABLED(BLTOUCH_HS_MODE)
+    #error "FLYING_PROBE with BLTOUCH requires BLTOUCH_HS_MODE."
+  #elif ENABLED(PROBE_TARE)
+    #error "FLYING_PROBE is not compatible with PROBE_TARE."
+  #elif MULTIPLE_PROBING > 1
+    #error "FLYING_PROBE takes one sample per point. Disable MULTIPLE_PROBING."
+  #elif !(FLYING_PROBE_CLEARANCE > 0)
+    #error "FLYING_PROBE_CLEARANCE must be greater than 0."
+  #endif
+#endif
+
 #if ENABLED(LEVEL_BED_CORNERS)
   #ifndef LEVEL_CORNERS_INSET_LFRB
     #error "LEVEL_BED_CORNERS requires LEVEL_CORNERS_INSET_LFRB values."
@@ -1524,6 +1573,14 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "GRID_MAX_POINTS_[XY] must be a whole number between 3 and 15."
   #endif
 
+  #if ENABLED(COMPRESSED_MESH_STORAGE)
+    #if ENABLED(OPTIMIZED_MESH_STORAGE)
+      #error "Enable only one of OPTIMIZED_MESH_STORAGE or COMPRESSED_MESH_STORAGE."
+    #elif !WITHIN(MESH_STORE_BYTES, (GRID_MAX_POINTS_X) * (GRID_MAX_POINTS_Y), 4096)
+      #error "MESH_STORE_BYTES must be between GRID_MAX_POINTS_X * GRID_MAX_POINTS_Y and 4096."
+    #endif
+  #endif
+
 #elif HAS_ABL_NOT_UBL
 
   /**
@@ -1537,6 +1594,19 @@ static_assert(Y_MAX_LENGTH >= Y_BED_SIZE, "Movement bounds (Y_MIN_POS, Y_MAX_POS
     #error "SCARA machines can only use the AUTO_BED_LEVELING_BILINEAR leveling option."
   #endif
 
+  /**
+   * Bicubic interpolation replaces the subdivided grid
+   */
+  #if ENABLED(ABL_BICUBIC_INTERPOLATION)
+    #if DISABLED(AUTO_BED_LEVELING_BILINEAR)
+      #error "ABL_BICUBIC_INTERPOLATION requires AUTO_BED_LEVELING_BILINEAR."
+    #elif ENABLED(ABL_BILINEAR_SUBDIVISION)
+      #error "Enable only one of ABL_BICUBIC_INTERPOLATION or ABL_BILINEAR_SUBDIVISION."
+    #elif IS_CARTESIAN && DISABLED(SEGMENT_LEVELED_MOVES)
+      #error "ABL_BICUBIC_INTERPOLATION requires SEGMENT_LEVELED_MOVES on Cartesian machines."
+    #endif
+  #endif
+
 #elif ENABLED(MESH_BED_LEVELING)
 
   // Mesh Bed Leveling
@@ -2292,6 +2362,13 @@ LINEAR_AXIS_CODE(
   #endif
 #endif
 
+/**
+ * SD read-ahead buffer
+ */
+#if HAS_SD_READ_AHEAD && !WITHIN(SD_READ_AHEAD_SECTORS, 1, 16)
+  #error "SD_READ_AHEAD_SECTORS must be between 1 and 16."
+#endif
+
 #if ENABLED(SD_IGNORE_AT_STARTUP)
   #if ENABLED(POWER_LOSS_RECOVERY)
     #error "SD_IGNORE_AT_STARTUP is incompatible with POWER_LOSS_RECOVERY."
@@ -2892,9 +2969,11 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "CNC_COORDINATE_SYSTEMS is incompatible with NO_WORKSPACE_OFFSETS."
 #endif
 
-#if !BLOCK_BUFFER_SIZE || !IS_POWER_OF_2(BLOCK_BUFFER_SIZE)
-  #error "BLOCK_BUFFER_SIZE must be a power of 2."
-#elif BLOCK_BUFFER_SIZE > 64
+#if BLOCK_BUFFER_SIZE < 2
+  #error "BLOCK_BUFFER_SIZE must be at least 2."
+#elif BLOCK_BUFFER_SIZE > 64 && !defined(CPU_32_BIT)
+  #error "A BLOCK_BUFFER_SIZE over 64 requires a 32-bit board."
+#elif BLOCK_BUFFER_SIZE > 512
   #error "A very large BLOCK_BUFFER_SIZE is not needed and takes longer to drain the buffer on pause / cancel."
 #endif
 
@@ -3198,6 +3277,147 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "SAVED_POSITIONS must be an integer from 0 to 256."
 #endif
 
+/**
+ * Fixed-point planner
+ */
+#if ENABLED(PLANNER_FIXED_POINT)
+  #if ENABLED(LASER_POWER_INLINE_TRAPEZOID)
+    #error "PLANNER_FIXED_POINT is not compatible with LASER_POWER_INLINE_TRAPEZOID."
+  #endif
+#elif ENABLED(PLANNER_FIXED_POINT_CHECK)
+  #error "PLANNER_FIXED_POINT_CHECK requires PLANNER_FIXED_POINT."
+#endif
+
+/**
+ * Step Schedule
+ */
+#if ENABLED(STEP_SCHEDULE)
+  #ifndef CPU_32_BIT
+    #error "STEP_SCHEDULE requires a 32-bit MCU."
+  #elif !defined(STEP_SCHEDULE_SIZE) || STEP_SCHEDULE_SIZE < 256 || STEP_SCHEDULE_SIZE > 4096
+    #error "STEP_SCHEDULE_SIZE must be from 256 to 4096."
+  #elif ENABLED(LIN_ADVANCE)
+    #error "STEP_SCHEDULE is not compatible with LIN_ADVANCE."
+  #elif ENABLED(DIRECT_STEPPING)
+    #error "STEP_SCHEDULE is not compatible with DIRECT_STEPPING."
+  #elif ENABLED(INTEGRATED_BABYSTEPPING)
+    #error "STEP_SCHEDULE is not compatible with INTEGRATED_BABYSTEPPING."
+  #elif ENABLED(LASER_POWER_INLINE)
+    #error "STEP_SCHEDULE is not compatible with LASER_POWER_INLINE."
+  #elif ENABLED(Z_LATE_ENABLE)
+    #error "STEP_SCHEDULE is not compatible with Z_LATE_ENABLE."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "STEP_SCHEDULE is not compatible with I2S_STEPPER_STREAM."
+  #elif HAS_L64XX
+    #error "STEP_SCHEDULE is not compatible with L64XX stepper drivers."
+  #elif ANY(HAS_MULTI_EXTRUDER, MIXING_EXTRUDER, DUAL_X_CARRIAGE)
+    #error "STEP_SCHEDULE is not compatible with multiple extruders, MIXING_EXTRUDER, or DUAL_X_CARRIAGE."
+  #endif
+#endif
+
+/**
+ * Input Shaping
+ */
+#if HAS_SHAPING
+  #ifndef CPU_32_BIT
+    #error "INPUT_SHAPING_[XY] requires a 32-bit MCU."
+  #elif IS_KINEMATIC || IS_CORE || ENABLED(MARKFORGED_XY)
+    #error "INPUT_SHAPING_[XY] requires Cartesian kinematics."
+  #elif ENABLED(STEP_SCHEDULE)
+    #error "INPUT_SHAPING_[XY] is not compatible with STEP_SCHEDULE."
+  #elif ENABLED(I2S_STEPPER_STREAM)
+    #error "INPUT_SHAPING_[XY] is not compatible with I2S_STEPPER_STREAM."
+  #elif ENABLED(BABYSTEP_XY)
+    #error "INPUT_SHAPING_[XY] is not compatible with BABYSTEP_XY."
+  #elif !defined(SHAPING_MIN_FREQ) || SHAPING_MIN_FREQ < 1
+    #error "SHAPING_MIN_FREQ must be 1Hz or more."
+  #elif !defined(SHAPING_BUFFER_SIZE) || SHAPING_BUFFER_SIZE < 64 || SHAPING_BUFFER_SIZE > 8192
+    #error "SHAPING_BUFFER_SIZE must be from 64 to 8192."
+  #endif
+  #if ENABLED(INPUT_SHAPING_X)
+    static_assert(SHAPING_FREQ_X == 0 || SHAPING_FREQ_X >= SHAPING_MIN_FREQ, "SHAPING_FREQ_X must be 0 or at least SHAPING_MIN_FREQ.");
+    static_assert(WITHIN(SHAPING_ZETA_X, 0, 0.99), "SHAPING_ZETA_X must be from 0 to 0.99.");
+    static_assert(WITHIN(SHAPING_TYPE_X, 0, 2), "SHAPING_TYPE_X must be 0 (ZV), 1 (ZVD) or 2 (EI).");
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    static_assert(SHAPING_FREQ_Y == 0 || SHAPING_FREQ_Y >= SHAPING_MIN_FREQ, "SHAPING_FREQ_Y must be 0 or at least SHAPING_MIN_FREQ.");
+    static_assert(WITHIN(SHAPING_ZETA_Y, 0, 0.99), "SHAPING_ZETA_Y must be from 0 to 0.99.");
+    static_assert(WITHIN(SHAPING_TYPE_Y, 0, 2), "SHAPING_TYPE_Y must be 0 (ZV), 1 (ZVD) or 2 (EI).");
+  #endif
+#endif
+
+/**
+ * Native Arc Blocks
+ */
+#if ENABLED(NATIVE_ARC_BLOCKS)
+  #if DISABLED(ARC_SUPPORT)
+    #error "NATIVE_ARC_BLOCKS requires ARC_SUPPORT."
+  #elif !defined(CPU_32_BIT)
+    #error "NATIVE_ARC_BLOCKS requires a 32-bit MCU."
+  #elif IS_KINEMATIC
+    #error "NATIVE_ARC_BLOCKS is not compatible with DELTA or SCARA."
+  #elif IS_CORE || ENABLED(MARKFORGED_XY)
+    #error "NATIVE_ARC_BLOCKS is not compatible with COREXY, COREXZ, COREYZ, or MARKFORGED_XY."
+  #elif ENABLED(BACKLASH_COMPENSATION)
+    #error "NATIVE_ARC_BLOCKS is not compatible with BACKLASH_COMPENSATION."
+  #elif ENABLED(SKEW_CORRECTION)
+    #error "NATIVE_ARC_BLOCKS is not compatible with SKEW_CORRECTION."
+  #endif
+#endif
+
+/**
+ * Chordal Tolerance
+ */
+#ifdef CHORDAL_TOLERANCE
+  #if NONE(ARC_SUPPORT, BEZIER_CURVE_SUPPORT)
+    #error "CHORDAL_TOLERANCE requires ARC_SUPPORT or BEZIER_CURVE_SUPPORT."
+  #endif
+  static_assert(WITHIN(CHORDAL_TOLERANCE, 0.001, 1.0), "CHORDAL_TOLERANCE must be from 0.001 to 1.0.");
+#endif
+
+/**
+ * Incremental Delta Kinematics
+ */
+#if ENABLED(DELTA_INCREMENTAL_IK)
+  #if DISABLED(DELTA)
+    #error "DELTA_INCREMENTAL_IK requires DELTA."
+  #endif
+#elif ENABLED(DELTA_INCREMENTAL_IK_CHECK)
+  #error "DELTA_INCREMENTAL_IK_CHECK requires DELTA_INCREMENTAL_IK."
+#endif
+
+/**
+ * Stepper Leveling
+ */
+#if ENABLED(STEPPER_LEVELING)
+  #if NONE(MESH_BED_LEVELING, AUTO_BED_LEVELING_BILINEAR)
+    #error "STEPPER_LEVELING requires MESH_BED_LEVELING or AUTO_BED_LEVELING_BILINEAR."
+  #elif !defined(CPU_32_BIT)
+    #error "STEPPER_LEVELING requires a 32-bit MCU."
+  #elif IS_KINEMATIC || CORE_IS_XZ || CORE_IS_YZ
+    #error "STEPPER_LEVELING is not compatible with DELTA, SCARA, COREXZ, or COREYZ."
+  #elif ENABLED(SEGMENT_LEVELED_MOVES)
+    #error "STEPPER_LEVELING replaces SEGMENT_LEVELED_MOVES. Disable one of them."
+  #elif ENABLED(BACKLASH_COMPENSATION)
+    #error "STEPPER_LEVELING is not compatible with BACKLASH_COMPENSATION."
+  #elif EITHER(ABL_BILINEAR_SUBDIVISION, ABL_BICUBIC_INTERPOLATION)
+    #error "STEPPER_LEVELING is linear between grid lines. Disable ABL_BILINEAR_SUBDIVISION and ABL_BICUBIC_INTERPOLATION."
+  #elif !WITHIN(LEVELING_BLOCK_PIECES, 2, 32)
+    #error "LEVELING_BLOCK_PIECES must be from 2 to 32."
+  #endif
+#endif
+
+/**
+ * Thermistor Direct Lookup
+ */
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+  #if __cplusplus < 201402L
+    #error "THERMISTOR_DIRECT_LOOKUP requires C++14 or newer. Add -std=gnu++14 to your build flags."
+  #elif !defined(THERMISTOR_LOOKUP_BUCKETS) || THERMISTOR_LOOKUP_BUCKETS < 16 || THERMISTOR_LOOKUP_BUCKETS > 4096
+    #error "THERMISTOR_LOOKUP_BUCKETS must be from 16 to 4096."
+  #endif
+#endif
+
 /**
  * Stepper Chunk support
  */
@@ -3238,6 +3458,36 @@ static_assert(   _ARR_TEST(3,0) && _ARR_TEST(3,1) && _ARR_TEST(3,2)
   #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_FILE_TRANSFER, not both."
 #endif
 
+#if BOTH(HAS_MEATPACK, BINARY_GCODE_STREAM)
+  #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_GCODE_STREAM, not both."
+#endif
+
+/**
+ * Sanity Check for BINARY_GCODE_COMMANDS
+ */
+#if ENABLED(BINARY_GCODE_COMMANDS)
+  #if DISABLED(FASTER_GCODE_PARSER)
+    #error "BINARY_GCODE_COMMANDS requires FASTER_GCODE_PARSER."
+  #elif HAS_MEATPACK
+    #error "Either enable MEATPACK_ON_SERIAL_PORT_* or BINARY_GCODE_COMMANDS, not both."
+  #elif MAX_CMD_SIZE > 257
+    #error "BINARY_GCODE_COMMANDS requires MAX_CMD_SIZE of 257 or less."
+  #endif
+#endif
+
+/**
+ * Sanity Check for STREAM_WINDOW
+ */
+#if ENABLED(STREAM_WINDOW)
+  #if STREAM_WINDOW_LINES < BUFSIZE
+    #error "STREAM_WINDOW_LINES must be at least BUFSIZE."
+  #elif !WITHIN(STREAM_ACK_LINES, 1, STREAM_WINDOW_LINES / 2)
+    #error "STREAM_ACK_LINES must be between 1 and STREAM_WINDOW_LINES / 2."
+  #elif STREAM_WINDOW_BYTES < (STREAM_ACK_LINES) * (MAX_CMD_SIZE)
+    #error "STREAM_WINDOW_BYTES must hold STREAM_ACK_LINES lines of MAX_CMD_SIZE so the host never waits for credit that isn't coming."
+  #endif
+#endif
+
 /**
  * Sanity check for unique start and stop values in NOZZLE_CLEAN_FEATURE
  */
@@ -0,0 +1,77 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * fixedpoint.h - Unsigned Q16.16 helpers for boards without an FPU
+ *
+ * Fractions are uint32_t with 16 fractional bits (FIXED_ONE = 1.0).
+ * Everything here is done in 32-bit integer math.
+ */
+
+#include <stdint.h>
+
+typedef uint32_t ufixed_t;
+
+#define FIXED_ONE 0x10000UL
+
+// Integer square root, rounded down
+inline uint16_t isqrt32(uint32_t x) {
+  uint32_t res = 0, bit = 1UL << 30;
+  while (bit > x) bit >>= 2;
+  while (bit) {
+    if (x >= res + bit) { x -= res + bit; res = (res >> 1) + bit; }
+    else res >>= 1;
+    bit >>= 2;
+  }
+  return res;
+}
+
+// num / den as a fraction, saturated at 1.0. Shift-and-subtract division,
+// exact to 16 bits for any den below 2^31 and no 64-bit math needed.
+inline ufixed_t fixed_fraction(uint32_t num, const uint32_t den) {
+  if (num >= den) return FIXED_ONE;
+  ufixed_t q = 0;
+  for (uint8_t i = 16; i--;) {
+    num <<= 1; q <<= 1;
+    if (num >= den) { num -= den; q |= 1; }
+  }
+  return q;
+}
+
+// Square root of a fraction up to 1.0
+inline ufixed_t fixed_sqrt(const ufixed_t f) {
+  return f >= FIXED_ONE ? FIXED_ONE : isqrt32(f << 16);
+}
+
+// x * f for a fraction up to 1.0, rounded down
+inline uint32_t fixed_scale(const uint32_t x, const ufixed_t f) {
+  if (f >= FIXED_ONE) return x;
+  return (x >> 16) * f + (((x & 0xFFFF) * f) >> 16);
+}
+
+// x * f for a fraction up to 1.0, rounded up
+inline uint32_t fixed_scale_ceil(const uint32_t x, const ufixed_t f) {
+  if (f >= FIXED_ONE) return x;
+  const uint32_t lo = (x & 0xFFFF) * f;
+  return (x >> 16) * f + (lo >> 16) + !!(lo & 0xFFFF);
+}
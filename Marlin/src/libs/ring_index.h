@@ -0,0 +1,56 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#pragma once
+
+/**
+ * ring_index.h - Index arithmetic for ring buffers of any size
+ *
+ * RingIndex<N>::type is the smallest index type that can address N slots:
+ * uint8_t up to 256 slots, uint16_t above that. Power-of-two sizes wrap
+ * with a mask, other sizes with a compare, so no size pays for a modulo.
+ *
+ * A ring buffer shared with an ISR stays safe as long as each index has a
+ * single writer and index reads/writes are atomic. On 8-bit AVR that holds
+ * only for uint8_t, so larger rings need a 32-bit CPU.
+ */
+
+#include "../core/macros.h"
+#include "../core/types.h"
+
+template<uint16_t N>
+struct RingIndex {
+  static_assert(N, "A ring buffer needs at least one slot.");
+
+  typedef typename IF<(N > 256), uint16_t, uint8_t>::type type;
+
+  static constexpr uint16_t size = N;
+  static constexpr bool is_pow2 = IS_POWER_OF_2(N);
+
+  // The index after / before i
+  static constexpr type next(const type i) { return is_pow2 ? type((i + 1) & (N - 1)) : type(i + 1 < N ? i + 1 : 0); }
+  static constexpr type prev(const type i) { return is_pow2 ? type((i - 1) & (N - 1)) : type(i ? i - 1 : N - 1); }
+
+  // Number of slots from 'from' up to (not including) 'to'
+  static constexpr type distance(const type from, const type to) {
+    return is_pow2 ? type((to - from) & (N - 1)) : type(to >= from ? to - from : to + N - from);
+  }
+};
@@ -0,0 +1,65 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+/**
+ * chordal.cpp
+ *
+ * Size G2/G3 arc and G5 curve segments by their maximum chord error
+ */
+
+#include "../inc/MarlinConfig.h"
+
+#if HAS_CHORDAL_TOLERANCE
+
+#include "chordal.h"
+#include "planner.h"
+
+ChordalSegmenter segmenter;
+
+float ChordalSegmenter::tolerance; // Initialized by settings.load()
+uint16_t ChordalSegmenter::plan_us; // = 0
+
+/**
+ * A segment that takes less time to move than to plan drains the planner
+ * buffer, and a starved planner stalls the print far worse than a coarse
+ * chord. As the buffer empties make each segment last up to twice as long
+ * as it takes to buffer one. With a healthy queue accuracy wins.
+ */
+float ChordalSegmenter::min_length(const_feedRate_t fr_mm_s) {
+  return fr_mm_s * (plan_us * 1e-6f) * (2.0f * planner.moves_free() / (BLOCK_BUFFER_SIZE));
+}
+
+bool ChordalSegmenter::buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters
+  OPTARG(SCARA_FEEDRATE_SCALING, const_float_t inv_duration)
+) {
+  // A full buffer waits in idle() for a free block, so only time the planner when it won't
+  const bool timed = planner.moves_free();
+  const uint32_t start_us = micros();
+  const bool ok = planner.buffer_line(cart, fr_mm_s, extruder, millimeters OPTARG(SCARA_FEEDRATE_SCALING, inv_duration));
+  if (timed) {
+    const uint32_t took_us = _MIN(micros() - start_us, uint32_t(UINT16_MAX));
+    plan_us = (uint32_t(plan_us) * 7 + took_us) >> 3;
+  }
+  return ok;
+}
+
+#endif // HAS_CHORDAL_TOLERANCE
@@ -0,0 +1,56 @@
+/**
+ * Marlin 3D Printer Firmware
+ * Copyright (c) 2020 MarlinFirmware [https://github.com/MarlinFirmware/Marlin]
+ *
+ * Based on Sprinter and grbl.
+ * Copyright (c) 2011 Camiel Gubbels / Erik van der Zalm
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+
+#pragma once
+
+/**
+ * chordal.h
+ *
+ * Size G2/G3 arc and G5 curve segments by their maximum chord error
+ */
+
+#include "../inc/MarlinConfig.h"
+
+class ChordalSegmenter {
+  public:
+    static float tolerance;   // (mm) Furthest a segment may stray from the true curve. M214 S
+
+    static void reset() { tolerance = float(CHORDAL_TOLERANCE); }
+
+    // Length of the longest chord within tolerance of a circle with the given radius
+    static float arc_chord(const_float_t radius) {
+      return radius > tolerance ? 2.0f * SQRT(tolerance * (2.0f * radius - tolerance)) : 2.0f * radius;
+    }
+
+    // Shortest segment the planner can keep ahead of at the given feedrate
+    static float min_length(const_feedRate_t fr_mm_s);
+
+    // Planner::buffer_line, also timing the planner for min_length()
+    static bool buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters=0.0
+      OPTARG(SCARA_FEEDRATE_SCALING, const_float_t inv_duration=0.0)
+    );
+
+  private:
+    static uint16_t plan_us;  // (µs) Smoothed time to buffer one segment
+};
+
+extern ChordalSegmenter segmenter;
@@ -139,6 +139,99 @@ void inverse_kinematics(const xyz_pos_t &raw) {
   #endif
 }
 
+#if ENABLED(DELTA_INCREMENTAL_IK)
+
+  // Segments between exact recalculations of q, to stop float error building up in the differences
+  #define DELTA_IK_ANCHOR 32
+
+  void DeltaLineIK::start(const xyze_pos_t &raw, const xyze_float_t &step) {
+    // Planner::buffer_line applies these to each segment. Skew and
+    // retraction are affine, so the segments remain evenly spaced.
+    xyze_pos_t a = raw, b = raw + step;
+    #if HAS_POSITION_MODIFIERS
+      planner.apply_modifiers(a, false);
+      planner.apply_modifiers(b, false);
+    #endif
+    #if HAS_HOTEND_OFFSET
+      // Delta hotend offsets must be applied in Cartesian space with no "spoofing"
+      a.x -= hotend_offset[active_extruder].x; a.y -= hotend_offset[active_extruder].y;
+      b.x -= hotend_offset[active_extruder].x; b.y -= hotend_offset[active_extruder].y;
+    #endif
+
+    w.set(a.x, a.y);
+    d.set(b.x - a.x, b.y - a.y);
+    z = a.z;
+    dz = b.z - a.z;
+    ddq = -2 * HYPOT2(d.x, d.y);
+    n = 0;
+    anchor();
+    LOOP_ABC(i) {
+      h[i] = SQRT(q[i]);
+      hr[i] = 0.5f / h[i];
+    }
+
+    #if ENABLED(DELTA_INCREMENTAL_IK_CHECK)
+      pos.set(a.x, a.y, a.z);
+      pos_step.set(d.x, d.y, dz);
+    #endif
+  }
+
+  // Set q and its first difference exactly for segment n
+  void DeltaLineIK::anchor() {
+    const float px = w.x + d.x * n, py = w.y + d.y * n;
+    LOOP_ABC(i) {
+      const float tx = delta_tower[i].x - px, ty = delta_tower[i].y - py;
+      q[i] = delta_diagonal_rod_2_tower[i] - HYPOT2(tx, ty);
+      dq[i] = 2 * (tx * d.x + ty * d.y) + 0.5f * ddq;
+    }
+  }
+
+  void DeltaLineIK::next() {
+    if (++n % (DELTA_IK_ANCHOR))
+      LOOP_ABC(i) { q[i] += dq[i]; dq[i] += ddq; }
+    else
+      anchor();
+
+    z += dz;
+    LOOP_ABC(i) {
+      // One Newton step from the last height. A tower that moved
+      // more than 1/256 of its height gets the exact square root.
+      const float dh = (q[i] - sq(h[i])) * hr[i];
+      if (ABS(dh) < h[i] * (1.0f / 256)) {
+        h[i] += dh;
+        hr[i] *= 1.5f - 2 * q[i] * sq(hr[i]);
+      }
+      else {
+        h[i] = SQRT(q[i]);
+        hr[i] = 0.5f / h[i];
+      }
+      delta[i] = z + h[i];
+    }
+
+    TERN_(DELTA_INCREMENTAL_IK_CHECK, check());
+  }
+
+  #if ENABLED(DELTA_INCREMENTAL_IK_CHECK)
+
+    /**
+     * Compare with the exact inverse kinematics and report
+     * whenever the difference reaches a new high.
+     */
+    void DeltaLineIK::check() {
+      static float max_error;
+      const xyz_pos_t p = pos + pos_step * n;
+      float error = 0;
+      LOOP_ABC(i) NOLESS(error, ABS(delta[i] - (DELTA_Z(p, i))));
+      if (error > max_error) {
+        max_error = error;
+        SERIAL_ECHOLNPAIR("Incremental IK error: ", max_error * 1000, "um");
+      }
+    }
+
+  #endif
+
+#endif // DELTA_INCREMENTAL_IK
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
@@ -89,6 +89,43 @@ void recalc_delta_settings();
 
 void inverse_kinematics(const xyz_pos_t &raw);
 
+#if ENABLED(DELTA_INCREMENTAL_IK)
+
+  /**
+   * Incremental Delta Inverse Kinematics
+   *
+   * Step the tower positions along a segmented straight line.
+   *
+   * The square of each carriage's height above the effector is
+   * a quadratic in the segment number, so it is stepped exactly by
+   * forward differences. The height itself follows from a Newton step
+   * away from the previous segment's height. Its reciprocal is kept
+   * by an inverse square root Newton step, so no division or square
+   * root is needed unless a tower moves too far in one segment.
+   */
+  class DeltaLineIK {
+    public:
+      // Begin a line at 'raw' with segments of 'step'. The result of each next() is stored in delta[].
+      void start(const xyze_pos_t &raw, const xyze_float_t &step);
+      void next();
+
+    private:
+      abc_float_t q, dq,  // Squared carriage heights above the effector and their first differences
+                  h, hr;  // Carriage heights above the effector and 0.5 / height
+      float ddq,          // Second difference of q, the same for all towers
+            z, dz;        // Effector height
+      xy_float_t w, d;    // Effector start and step, for re-anchoring q
+      uint16_t n;         // Segment number
+      void anchor();
+      #if ENABLED(DELTA_INCREMENTAL_IK_CHECK)
+        xyz_pos_t pos;          // Effector start and step, for the exact solution
+        xyz_float_t pos_step;
+        void check();
+      #endif
+  };
+
+#endif
+
 /**
  * Calculate the highest Z position where the
  * effector has the full range of XY motion.
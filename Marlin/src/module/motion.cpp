@@ -875,6 +875,13 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
     // Get the current position as starting point
     xyze_pos_t raw = current_position;
 
+    #if ENABLED(DELTA_INCREMENTAL_IK)
+      // Step the towers along the line, unless leveling bends it
+      DeltaLineIK line_ik;
+      const bool incremental = TERN1(PLANNER_LEVELING, !planner.leveling_active);
+      if (incremental) line_ik.start(raw, segment_distance);
+    #endif
+
     // Calculate and execute the segments
     millis_t next_idle_ms = millis() + 200UL;
     while (--segments) {
@@ -882,6 +889,7 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
       raw += segment_distance;
       if (!planner.buffer_line(raw, scaled_fr_mm_s, active_extruder, cartesian_segment_mm
         OPTARG(SCARA_FEEDRATE_SCALING, inv_duration)
+        OPTARG(DELTA_INCREMENTAL_IK, incremental ? &line_ik : nullptr)
       )) break;
     }
 
@@ -967,7 +975,8 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
    * Prepare a linear move in a Cartesian setup.
    *
    * When a mesh-based leveling system is active, moves are segmented
-   * according to the configuration of the leveling system.
+   * according to the configuration of the leveling system. With
+   * STEPPER_LEVELING the Stepper ISR follows the mesh instead.
    *
    * Return true if 'current_position' was set to 'destination'
    */
@@ -978,6 +987,9 @@ FORCE_INLINE void segment_idle(millis_t &next_idle_ms) {
         #if ENABLED(AUTO_BED_LEVELING_UBL)
           ubl.line_to_destination_cartesian(scaled_fr_mm_s, active_extruder); // UBL's motion routine needs to know about
           return true;                                                        // all moves, including Z-only moves.
+        #elif ENABLED(STEPPER_LEVELING)
+          planner.buffer_leveled_line(current_position, destination, scaled_fr_mm_s, active_extruder);
+          return false; // caller will update current_position
         #elif ENABLED(SEGMENT_LEVELED_MOVES)
           segmented_line_to_destination(scaled_fr_mm_s);
           return false; // caller will update current_position
@@ -123,13 +123,18 @@ Planner planner;
  * A ring buffer of moves described in steps
  */
 block_t Planner::block_buffer[BLOCK_BUFFER_SIZE];
-volatile uint8_t Planner::block_buffer_head,    // Index of the next block to be pushed
-                 Planner::block_buffer_nonbusy, // Index of the first non-busy block
-                 Planner::block_buffer_planned, // Index of the optimally planned block
-                 Planner::block_buffer_tail;    // Index of the busy block, if any
+volatile block_index_t Planner::block_buffer_head,    // Index of the next block to be pushed
+                       Planner::block_buffer_nonbusy, // Index of the first non-busy block
+                       Planner::block_buffer_planned, // Index of the optimally planned block
+                       Planner::block_buffer_tail;    // Index of the busy block, if any
 uint16_t Planner::cleaning_buffer_counter;      // A counter to disable queuing of blocks
 uint8_t Planner::delay_before_delivering;       // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+#if ENABLED(STEP_SCHEDULE)
+  volatile uint16_t Planner::scheduled_block_count, // Blocks released into the step schedule
+                    Planner::stepped_block_count;   // Blocks finished by the Stepper ISR
+#endif
+
 planner_settings_t Planner::settings;           // Initialized by settings.load()
 
 #if ENABLED(LASER_POWER_INLINE)
@@ -725,7 +730,7 @@ void Planner::init() {
  */
 block_t* Planner::get_current_block() {
   // Get the number of moves in the planner queue so far
-  const uint8_t nr_moves = movesplanned();
+  const block_index_t nr_moves = movesplanned();
 
   // If there are any moves queued ...
   if (nr_moves) {
@@ -765,6 +770,33 @@ block_t* Planner::get_current_block() {
   return nullptr;
 }
 
+#if ENABLED(S_CURVE_JERK_LIMITED)
+
+  /**
+   * The highest speed that can ramp to or from 'v' within 'distance'.
+   *
+   * With the full acceleration reached, distance = (2v + dv) * (dv / accel + accel / jerk) / 2,
+   * a quadratic in dv. Shorter ramps only have the jerk phases of x seconds each, with
+   * dv = jerk * x^2 and distance = jerk * x^3 + 2v * x. That cubic is convex and rising,
+   * so Newton's method started above the root closes in on it from above.
+   */
+  float Planner::jerk_ramp_speed(const_float_t v, const_float_t distance, const_float_t accel, const_float_t jerk) {
+    if (distance <= 0) return v;
+    const float full_dv = sq(accel) / jerk;
+    if (distance >= (2 * v + full_dv) * accel / jerk) {
+      const float b = 2 * v + full_dv, c = 2 * (v * full_dv - distance * accel);
+      return v + (SQRT(sq(b) - 4 * c) - b) * 0.5f;
+    }
+    float x = cbrtf(distance / jerk);
+    if (v > 0) NOMORE(x, distance / (2 * v));
+    LOOP_L_N(i, 4) x -= (jerk * x * x * x + 2 * v * x - distance) / (3 * jerk * x * x + 2 * v);
+    return v + jerk * x * x;
+  }
+
+#endif
+
+#if DISABLED(PLANNER_FIXED_POINT) || ENABLED(PLANNER_FIXED_POINT_CHECK)
+
 /**
  * Calculate trapezoid parameters, multiplying the entry- and exit-speeds
  * by the provided factors.
@@ -784,38 +816,89 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   NOLESS(initial_rate, uint32_t(MINIMAL_STEP_RATE));
   NOLESS(final_rate, uint32_t(MINIMAL_STEP_RATE));
 
-  #if ENABLED(S_CURVE_ACCELERATION)
-    uint32_t cruise_rate = initial_rate;
-  #endif
+  #if ENABLED(S_CURVE_JERK_LIMITED)
+
+    // Constant-jerk ramps, worked out in steps
+    const float accel = block->acceleration_steps_per_s2,
+                jerk = jerk_mm_per_s3(block) * block->step_event_count / block->millimeters;
+
+    uint32_t cruise_rate = block->nominal_rate,
+             accelerate_steps = CEIL(jerk_ramp_distance(initial_rate, cruise_rate, accel, jerk)),
+             decelerate_steps = FLOOR(jerk_ramp_distance(cruise_rate, final_rate, accel, jerk));
+    int32_t plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
+
+    // No cruising. Find the highest rate that still leaves room to reach the final rate.
+    if (plateau_steps < 0) {
+      const float lo_rate = _MAX(initial_rate, final_rate), full_dr = sq(accel) / jerk,
+                  steps = block->step_event_count;
+      // With both ramps reaching the full acceleration their distances add up to
+      // c^2 / accel + c * accel / jerk + k, with k not depending on the cruise rate c.
+      const float b = accel / jerk,
+                  k = (float(initial_rate) + final_rate) * b * 0.5f - (sq(float(initial_rate)) + sq(float(final_rate))) / (accel * 2) - steps,
+                  c = (SQRT(sq(b) - 4 * k / accel) - b) * accel * 0.5f;
+      float rate = c;
+      if (!(c - lo_rate >= full_dr)) {
+        // A short ramp has no constant acceleration. Search instead.
+        float lo = lo_rate, hi = cruise_rate;
+        LOOP_L_N(i, 12) {
+          const float mid = (lo + hi) * 0.5f;
+          if (jerk_ramp_distance(initial_rate, mid, accel, jerk) + jerk_ramp_distance(mid, final_rate, accel, jerk) > steps)
+            hi = mid;
+          else
+            lo = mid;
+        }
+        rate = lo;
+      }
+      cruise_rate = _MIN(uint32_t(_MAX(rate, lo_rate)), block->nominal_rate);
+      accelerate_steps = _MIN(uint32_t(CEIL(jerk_ramp_distance(initial_rate, cruise_rate, accel, jerk))), block->step_event_count);
+      plateau_steps = 0;
+    }
 
-  const int32_t accel = block->acceleration_steps_per_s2;
+    // Ramp times and the time spent changing the acceleration at each end
+    auto jerk_time = [&](const uint32_t dr) -> float {
+      return dr * jerk < sq(accel) ? SQRT(dr / jerk) : accel / jerk;
+    };
+    const uint32_t acceleration_time = jerk_ramp_time(cruise_rate - initial_rate, accel, jerk) * (STEPPER_TIMER_RATE),
+                   deceleration_time = jerk_ramp_time(cruise_rate - final_rate, accel, jerk) * (STEPPER_TIMER_RATE),
+                   acceleration_jerk_time = jerk_time(cruise_rate - initial_rate) * (STEPPER_TIMER_RATE),
+                   deceleration_jerk_time = jerk_time(cruise_rate - final_rate) * (STEPPER_TIMER_RATE);
 
-          // Steps required for acceleration, deceleration to/from nominal rate
-  uint32_t accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
-           decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel));
-          // Steps between acceleration and deceleration, if any
-  int32_t plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
+  #else
 
-  // Does accelerate_steps + decelerate_steps exceed step_event_count?
-  // Then we can't possibly reach the nominal rate, there will be no cruising.
-  // Use intersection_distance() to calculate accel / braking time in order to
-  // reach the final_rate exactly at the end of this block.
-  if (plateau_steps < 0) {
-    const float accelerate_steps_float = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
-    accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
-    plateau_steps = 0;
+    #if ENABLED(S_CURVE_ACCELERATION)
+      uint32_t cruise_rate = initial_rate;
+    #endif
 
+    const int32_t accel = block->acceleration_steps_per_s2;
+
+            // Steps required for acceleration, deceleration to/from nominal rate
+    uint32_t accelerate_steps = CEIL(estimate_acceleration_distance(initial_rate, block->nominal_rate, accel)),
+             decelerate_steps = FLOOR(estimate_acceleration_distance(block->nominal_rate, final_rate, -accel));
+            // Steps between acceleration and deceleration, if any
+    int32_t plateau_steps = block->step_event_count - accelerate_steps - decelerate_steps;
+
+    // Does accelerate_steps + decelerate_steps exceed step_event_count?
+    // Then we can't possibly reach the nominal rate, there will be no cruising.
+    // Use intersection_distance() to calculate accel / braking time in order to
+    // reach the final_rate exactly at the end of this block.
+    if (plateau_steps < 0) {
+      const float accelerate_steps_float = CEIL(intersection_distance(initial_rate, final_rate, accel, block->step_event_count));
+      accelerate_steps = _MIN(uint32_t(_MAX(accelerate_steps_float, 0)), block->step_event_count);
+      plateau_steps = 0;
+
+      #if ENABLED(S_CURVE_ACCELERATION)
+        // We won't reach the cruising rate. Let's calculate the speed we will reach
+        cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
+      #endif
+    }
     #if ENABLED(S_CURVE_ACCELERATION)
-      // We won't reach the cruising rate. Let's calculate the speed we will reach
-      cruise_rate = final_speed(initial_rate, accel, accelerate_steps);
+      else // We have some plateau time, so the cruise rate will be the nominal rate
+        cruise_rate = block->nominal_rate;
     #endif
-  }
-  #if ENABLED(S_CURVE_ACCELERATION)
-    else // We have some plateau time, so the cruise rate will be the nominal rate
-      cruise_rate = block->nominal_rate;
+
   #endif
 
-  #if ENABLED(S_CURVE_ACCELERATION)
+  #if ENABLED(HAS_BEZIER_S_CURVE)
     // Jerk controlled speed requires to express speed versus time, NOT steps
     uint32_t acceleration_time = ((float)(cruise_rate - initial_rate) / accel) * (STEPPER_TIMER_RATE),
              deceleration_time = ((float)(cruise_rate - final_rate) / accel) * (STEPPER_TIMER_RATE),
@@ -831,9 +914,15 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   #if ENABLED(S_CURVE_ACCELERATION)
     block->acceleration_time = acceleration_time;
     block->deceleration_time = deceleration_time;
+    block->cruise_rate = cruise_rate;
+  #endif
+  #if ENABLED(HAS_BEZIER_S_CURVE)
     block->acceleration_time_inverse = acceleration_time_inverse;
     block->deceleration_time_inverse = deceleration_time_inverse;
-    block->cruise_rate = cruise_rate;
+  #elif ENABLED(S_CURVE_JERK_LIMITED)
+    block->acceleration_jerk_time = acceleration_jerk_time;
+    block->deceleration_jerk_time = deceleration_jerk_time;
+    block->jerk_rate = jerk * (float(1ULL << 47) / sq(float(STEPPER_TIMER_RATE)));
   #endif
   block->final_rate = final_rate;
 
@@ -879,6 +968,121 @@ void Planner::calculate_trapezoid_for_block(block_t * const block, const_float_t
   #endif
 }
 
+#endif // !PLANNER_FIXED_POINT || PLANNER_FIXED_POINT_CHECK
+
+#if ENABLED(PLANNER_FIXED_POINT)
+
+/**
+ * calculate_trapezoid_for_block in integer math, from the entry and exit speeds squared.
+ *
+ * The rates scale with the speeds, and the fraction of the block taken to change speed
+ * is the same in steps as in mm: (v1^2 - v0^2) / (2 * acceleration * millimeters).
+ *
+ * Same PRECONDITION as above: the block is NOT BUSY and is marked as RECALCULATE.
+ */
+void Planner::calculate_trapezoid_for_block(block_t * const block, const speed_sqr_t entry_speed_sqr, const speed_sqr_t exit_speed_sqr) {
+
+  const speed_sqr_t nominal_sqr = block->fixed_nominal_speed_sqr,
+                    accel_sqr = block->accel_distance_sqr;
+  const uint32_t step_event_count = block->step_event_count;
+
+  uint32_t initial_rate = fixed_scale_ceil(block->nominal_rate, fixed_sqrt(fixed_fraction(entry_speed_sqr, nominal_sqr))),
+           final_rate = fixed_scale_ceil(block->nominal_rate, fixed_sqrt(fixed_fraction(exit_speed_sqr, nominal_sqr)));
+
+  // Limit minimal step rate (Otherwise the timer will overflow.)
+  NOLESS(initial_rate, uint32_t(MINIMAL_STEP_RATE));
+  NOLESS(final_rate, uint32_t(MINIMAL_STEP_RATE));
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+    uint32_t cruise_rate = initial_rate;
+  #endif
+
+          // Steps required for acceleration, deceleration to/from nominal rate
+  uint32_t accelerate_steps = nominal_sqr > entry_speed_sqr ? fixed_scale_ceil(step_event_count, fixed_fraction(nominal_sqr - entry_speed_sqr, accel_sqr)) : 0,
+           decelerate_steps = nominal_sqr > exit_speed_sqr ? fixed_scale(step_event_count, fixed_fraction(nominal_sqr - exit_speed_sqr, accel_sqr)) : 0;
+          // Steps between acceleration and deceleration, if any
+  int32_t plateau_steps = step_event_count - accelerate_steps - decelerate_steps;
+
+  // No cruising. Accelerate up to the point where braking reaches
+  // the exit speed at the end: (accel + exit^2 - entry^2) / (2 * accel)
+  if (plateau_steps < 0) {
+    const speed_sqr_t gain_sqr = accel_sqr + exit_speed_sqr;
+    accelerate_steps = gain_sqr > entry_speed_sqr ? fixed_scale_ceil(step_event_count, fixed_fraction((gain_sqr - entry_speed_sqr) >> 1, accel_sqr)) : 0;
+    plateau_steps = 0;
+
+    #if ENABLED(S_CURVE_ACCELERATION)
+      // We won't reach the cruising rate. Let's calculate the rate we will reach
+      const speed_sqr_t cruise_sqr = entry_speed_sqr + fixed_scale(accel_sqr, fixed_fraction(accelerate_steps, step_event_count));
+      cruise_rate = fixed_scale(block->nominal_rate, fixed_sqrt(fixed_fraction(cruise_sqr, nominal_sqr)));
+      NOLESS(cruise_rate, initial_rate);
+    #endif
+  }
+  #if ENABLED(S_CURVE_ACCELERATION)
+    else // We have some plateau time, so the cruise rate will be the nominal rate
+      cruise_rate = block->nominal_rate;
+  #endif
+
+  #if ENABLED(S_CURVE_ACCELERATION)
+    // Jerk controlled speed requires to express speed versus time, NOT steps:
+    // (rate change / accel) seconds, as whole seconds plus a fraction
+    const uint32_t accel = block->acceleration_steps_per_s2;
+    auto rate_change_time = [accel](const uint32_t dr) -> uint32_t {
+      return (dr / accel) * (STEPPER_TIMER_RATE) + fixed_scale(STEPPER_TIMER_RATE, fixed_fraction(dr % accel, accel));
+    };
+    uint32_t acceleration_time = rate_change_time(cruise_rate - initial_rate),
+             deceleration_time = cruise_rate > final_rate ? rate_change_time(cruise_rate - final_rate) : 0,
+    // And to offload calculations from the ISR, we also calculate the inverse of those times here
+             acceleration_time_inverse = get_period_inverse(acceleration_time),
+             deceleration_time_inverse = get_period_inverse(deceleration_time);
+  #endif
+
+  // Store new block parameters
+  block->accelerate_until = accelerate_steps;
+  block->decelerate_after = accelerate_steps + plateau_steps;
+  block->initial_rate = initial_rate;
+  #if ENABLED(S_CURVE_ACCELERATION)
+    block->acceleration_time = acceleration_time;
+    block->deceleration_time = deceleration_time;
+    block->acceleration_time_inverse = acceleration_time_inverse;
+    block->deceleration_time_inverse = deceleration_time_inverse;
+    block->cruise_rate = cruise_rate;
+  #endif
+  block->final_rate = final_rate;
+
+  TERN_(PLANNER_FIXED_POINT_CHECK, check_fixed_trapezoid(block, entry_speed_sqr, exit_speed_sqr));
+}
+
+#if ENABLED(PLANNER_FIXED_POINT_CHECK)
+
+  /**
+   * Run the float math on a copy of the block and report whenever
+   * the difference from the fixed-point result reaches a new high.
+   */
+  void Planner::check_fixed_trapezoid(const block_t * const block, const speed_sqr_t entry_speed_sqr, const speed_sqr_t exit_speed_sqr) {
+    static uint32_t max_steps_error;
+    static float max_rate_error;
+
+    block_t ref;
+    memcpy((void*)&ref, (const void*)block, sizeof(ref));
+    const float nomr = 1.0f / SQRT(block->nominal_speed_sqr);
+    calculate_trapezoid_for_block(&ref, SQRT(from_speed_sqr(entry_speed_sqr)) * nomr, SQRT(from_speed_sqr(exit_speed_sqr)) * nomr);
+
+    const uint32_t steps_error = _MAX(ABS(int32_t(block->accelerate_until - ref.accelerate_until)),
+                                      ABS(int32_t(block->decelerate_after - ref.decelerate_after)));
+    const float rate_error = _MAX(ABS(float(block->initial_rate) - ref.initial_rate) / ref.initial_rate,
+                                  ABS(float(block->final_rate) - ref.final_rate) / ref.final_rate);
+
+    if (steps_error > max_steps_error || rate_error > max_rate_error) {
+      NOLESS(max_steps_error, steps_error);
+      NOLESS(max_rate_error, rate_error);
+      SERIAL_ECHOLNPAIR("Fixed-point trapezoid error: ", max_steps_error, " of ", block->step_event_count, " steps, rate ", max_rate_error * 100, "%");
+    }
+  }
+
+#endif
+
+#endif // PLANNER_FIXED_POINT
+
 /*                            PLANNER SPEED DEFINITION
                                      +--------+   <- current->nominal_speed
                                     /          \
@@ -948,7 +1152,7 @@ void Planner::reverse_pass_kernel(block_t * const current, const block_t * const
     // in the next block, there is no need to recheck. Block is cruising and there is no need to
     // compute anything for this block,
     // If not, block entry speed needs to be recalculated to ensure maximum possible planned speed.
-    const float max_entry_speed_sqr = current->max_entry_speed_sqr;
+    const speed_sqr_t max_entry_speed_sqr = current->max_entry_speed_sqr;
 
     // Compute maximum entry speed decelerating over the current block from its exit speed.
     // If not at the maximum entry speed, or the previous block entry speed changed
@@ -962,9 +1166,9 @@ void Planner::reverse_pass_kernel(block_t * const current, const block_t * const
       // the reverse and forward planners, the corresponding block junction speed will always be at the
       // the maximum junction speed and may always be ignored for any speed reduction checks.
 
-      const float new_entry_speed_sqr = TEST(current->flag, BLOCK_BIT_NOMINAL_LENGTH)
+      const speed_sqr_t new_entry_speed_sqr = TEST(current->flag, BLOCK_BIT_NOMINAL_LENGTH)
         ? max_entry_speed_sqr
-        : _MIN(max_entry_speed_sqr, max_allowable_speed_sqr(-current->acceleration, next ? next->entry_speed_sqr : sq(float(MINIMUM_PLANNER_SPEED)), current->millimeters));
+        : _MIN(max_entry_speed_sqr, entry_speed_sqr_limit(current, next ? next->entry_speed_sqr : min_speed_sqr()));
       if (current->entry_speed_sqr != new_entry_speed_sqr) {
 
         // Need to recalculate the block speed - Mark it now, so the stepper
@@ -992,19 +1196,24 @@ void Planner::reverse_pass_kernel(block_t * const current, const block_t * const
 /**
  * recalculate() needs to go over the current plan twice.
  * Once in reverse and once forward. This implements the reverse pass.
+ *
+ * The entry speed of a block only depends on the entry speed of the next one, so
+ * once a block comes out of the kernel unchanged, every block before it keeps the
+ * speeds of the last plan. The pass stops there and returns that block's index,
+ * so the rest of recalculate() only needs to look at the "dirty" tail after it.
  */
-void Planner::reverse_pass() {
+block_index_t Planner::reverse_pass() {
   // Initialize block index to the last block in the planner buffer.
-  uint8_t block_index = prev_block_index(block_buffer_head);
+  block_index_t block_index = prev_block_index(block_buffer_head);
 
   // Read the index of the last buffer planned block.
   // The ISR may change it so get a stable local copy.
-  uint8_t planned_block_index = block_buffer_planned;
+  block_index_t planned_block_index = block_buffer_planned;
 
   // If there was a race condition and block_buffer_planned was incremented
   //  or was pointing at the head (queue empty) break loop now and avoid
   //  planning already consumed blocks
-  if (planned_block_index == block_buffer_head) return;
+  if (planned_block_index == block_buffer_head) return planned_block_index;
 
   // Reverse Pass: Coarsely maximize all possible deceleration curves back-planning from the last
   // block in buffer. Cease planning when the last optimal planned or tail pointer is reached.
@@ -1018,6 +1227,8 @@ void Planner::reverse_pass() {
     // Only consider non sync-and-page blocks
     if (!(current->flag & BLOCK_MASK_SYNC) && !IS_PAGE(current)) {
       reverse_pass_kernel(current, next);
+      // Entry speed unchanged (or the block became busy). The plan before it is final.
+      if (next && !TEST(current->flag, BLOCK_BIT_RECALCULATE)) return block_index;
       next = current;
     }
 
@@ -1030,16 +1241,17 @@ void Planner::reverse_pass() {
     while (planned_block_index != block_buffer_planned) {
 
       // If we reached the busy block or an already processed block, break the loop now
-      if (block_index == planned_block_index) return;
+      if (block_index == planned_block_index) return planned_block_index;
 
       // Advance the pointer, following the busy block
       planned_block_index = next_block_index(planned_block_index);
     }
   }
+  return planned_block_index;
 }
 
 // The kernel called by recalculate() when scanning the plan from first to last entry.
-void Planner::forward_pass_kernel(const block_t * const previous, block_t * const current, const uint8_t block_index) {
+void Planner::forward_pass_kernel(const block_t * const previous, block_t * const current, const block_index_t block_index) {
   if (previous) {
     // If the previous block is an acceleration block, too short to complete the full speed
     // change, adjust the entry speed accordingly. Entry speeds have already been reset,
@@ -1049,7 +1261,7 @@ void Planner::forward_pass_kernel(const block_t * const previous, block_t * cons
       previous->entry_speed_sqr < current->entry_speed_sqr) {
 
       // Compute the maximum allowable speed
-      const float new_entry_speed_sqr = max_allowable_speed_sqr(-previous->acceleration, previous->entry_speed_sqr, previous->millimeters);
+      const speed_sqr_t new_entry_speed_sqr = entry_speed_sqr_limit(previous, previous->entry_speed_sqr);
 
       // If true, current block is full-acceleration and we can move the planned pointer forward.
       if (new_entry_speed_sqr < current->entry_speed_sqr) {
@@ -1090,9 +1302,10 @@ void Planner::forward_pass_kernel(const block_t * const previous, block_t * cons
 
 /**
  * recalculate() needs to go over the current plan twice.
- * Once in reverse and once forward. This implements the forward pass.
+ * Once in reverse and once forward. This implements the forward pass,
+ * starting from the first block the reverse pass may have changed.
  */
-void Planner::forward_pass() {
+void Planner::forward_pass(const block_index_t first_block_index) {
 
   // Forward Pass: Forward plan the acceleration curve from the planned pointer onward.
   // Also scans for optimal plan breakpoints and appropriately updates the planned pointer.
@@ -1101,7 +1314,11 @@ void Planner::forward_pass() {
   //  by the stepper ISR,  so read it ONCE. It it guaranteed that block_buffer_planned
   //  will never lead head, so the loop is safe to execute. Also note that the forward
   //  pass will never modify the values at the tail.
-  uint8_t block_index = block_buffer_planned;
+  block_index_t block_index = block_buffer_planned;
+
+  // Blocks before the first changed one already passed through here with the
+  // same entry speeds. Skip them, unless the ISR has moved past that point.
+  if (block_index_in_range(first_block_index, block_index)) block_index = first_block_index;
 
   block_t *block;
   const block_t * previous = nullptr;
@@ -1130,18 +1347,22 @@ void Planner::forward_pass() {
  * Recalculate the trapezoid speed profiles for all blocks in the plan
  * according to the entry_factor for each junction. Must be called by
  * recalculate() after updating the blocks.
+ *
+ * Only blocks from first_block_index onward can be marked RECALCULATE,
+ * so the scan begins there unless the ISR has already moved past it.
  */
-void Planner::recalculate_trapezoids() {
+void Planner::recalculate_trapezoids(const block_index_t first_block_index) {
   // The tail may be changed by the ISR so get a local copy.
-  uint8_t block_index = block_buffer_tail,
+  block_index_t block_index = block_buffer_tail,
           head_block_index = block_buffer_head;
+  if (block_index_in_range(first_block_index, block_index)) block_index = first_block_index;
   // Since there could be a sync block in the head of the queue, and the
   // next loop must not recalculate the head block (as it needs to be
   // specially handled), scan backwards to the first non-SYNC block.
   while (head_block_index != block_index) {
 
     // Go back (head always point to the first free block)
-    const uint8_t prev_index = prev_block_index(head_block_index);
+    const block_index_t prev_index = prev_block_index(head_block_index);
 
     // Get the pointer to the block
     block_t *prev = &block_buffer[prev_index];
@@ -1155,14 +1376,22 @@ void Planner::recalculate_trapezoids() {
 
   // Go from the tail (currently executed block) to the first block, without including it)
   block_t *block = nullptr, *next = nullptr;
-  float current_entry_speed = 0.0, next_entry_speed = 0.0;
+  #if ENABLED(PLANNER_FIXED_POINT)
+    speed_sqr_t current_entry_speed_sqr = 0, next_entry_speed_sqr = 0;
+  #else
+    float current_entry_speed = 0.0, next_entry_speed = 0.0;
+  #endif
   while (block_index != head_block_index) {
 
     next = &block_buffer[block_index];
 
     // Skip sync and page blocks
     if (!(next->flag & BLOCK_MASK_SYNC) && !IS_PAGE(next)) {
-      next_entry_speed = SQRT(next->entry_speed_sqr);
+      #if ENABLED(PLANNER_FIXED_POINT)
+        next_entry_speed_sqr = next->entry_speed_sqr;
+      #else
+        next_entry_speed = SQRT(next->entry_speed_sqr);
+      #endif
 
       if (block) {
         // Recalculate if current block entry or exit junction speed has changed.
@@ -1179,16 +1408,27 @@ void Planner::recalculate_trapezoids() {
           if (!stepper.is_block_busy(block)) {
             // Block is not BUSY, we won the race against the Stepper ISR:
 
-            // NOTE: Entry and exit factors always > 0 by all previous logic operations.
-            const float current_nominal_speed = SQRT(block->nominal_speed_sqr),
-                        nomr = 1.0f / current_nominal_speed;
-            calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
-            #if ENABLED(LIN_ADVANCE)
-              if (block->use_advance_lead) {
-                const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
-                block->max_adv_steps = current_nominal_speed * comp;
-                block->final_adv_steps = next_entry_speed * comp;
-              }
+            #if ENABLED(PLANNER_FIXED_POINT)
+              calculate_trapezoid_for_block(block, current_entry_speed_sqr, next_entry_speed_sqr);
+              #if ENABLED(LIN_ADVANCE)
+                if (block->use_advance_lead) {
+                  const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
+                  block->max_adv_steps = SQRT(block->nominal_speed_sqr) * comp;
+                  block->final_adv_steps = SQRT(from_speed_sqr(next_entry_speed_sqr)) * comp;
+                }
+              #endif
+            #else
+              // NOTE: Entry and exit factors always > 0 by all previous logic operations.
+              const float current_nominal_speed = SQRT(block->nominal_speed_sqr),
+                          nomr = 1.0f / current_nominal_speed;
+              calculate_trapezoid_for_block(block, current_entry_speed * nomr, next_entry_speed * nomr);
+              #if ENABLED(LIN_ADVANCE)
+                if (block->use_advance_lead) {
+                  const float comp = block->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
+                  block->max_adv_steps = current_nominal_speed * comp;
+                  block->final_adv_steps = next_entry_speed * comp;
+                }
+              #endif
             #endif
           }
 
@@ -1199,7 +1439,7 @@ void Planner::recalculate_trapezoids() {
       }
 
       block = next;
-      current_entry_speed = next_entry_speed;
+      TERN(PLANNER_FIXED_POINT, current_entry_speed_sqr = next_entry_speed_sqr, current_entry_speed = next_entry_speed);
     }
 
     block_index = next_block_index(block_index);
@@ -1219,15 +1459,26 @@ void Planner::recalculate_trapezoids() {
     if (!stepper.is_block_busy(block)) {
       // Block is not BUSY, we won the race against the Stepper ISR:
 
-      const float next_nominal_speed = SQRT(next->nominal_speed_sqr),
-                  nomr = 1.0f / next_nominal_speed;
-      calculate_trapezoid_for_block(next, next_entry_speed * nomr, float(MINIMUM_PLANNER_SPEED) * nomr);
-      #if ENABLED(LIN_ADVANCE)
-        if (next->use_advance_lead) {
-          const float comp = next->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
-          next->max_adv_steps = next_nominal_speed * comp;
-          next->final_adv_steps = (MINIMUM_PLANNER_SPEED) * comp;
-        }
+      #if ENABLED(PLANNER_FIXED_POINT)
+        calculate_trapezoid_for_block(next, next_entry_speed_sqr, min_speed_sqr());
+        #if ENABLED(LIN_ADVANCE)
+          if (next->use_advance_lead) {
+            const float comp = next->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
+            next->max_adv_steps = SQRT(next->nominal_speed_sqr) * comp;
+            next->final_adv_steps = (MINIMUM_PLANNER_SPEED) * comp;
+          }
+        #endif
+      #else
+        const float next_nominal_speed = SQRT(next->nominal_speed_sqr),
+                    nomr = 1.0f / next_nominal_speed;
+        calculate_trapezoid_for_block(next, next_entry_speed * nomr, float(MINIMUM_PLANNER_SPEED) * nomr);
+        #if ENABLED(LIN_ADVANCE)
+          if (next->use_advance_lead) {
+            const float comp = next->e_D_ratio * extruder_advance_K[active_extruder] * settings.axis_steps_per_mm[E_AXIS];
+            next->max_adv_steps = next_nominal_speed * comp;
+            next->final_adv_steps = (MINIMUM_PLANNER_SPEED) * comp;
+          }
+        #endif
       #endif
     }
 
@@ -1239,13 +1490,14 @@ void Planner::recalculate_trapezoids() {
 
 void Planner::recalculate() {
   // Initialize block index to the last block in the planner buffer.
-  const uint8_t block_index = prev_block_index(block_buffer_head);
+  const block_index_t block_index = prev_block_index(block_buffer_head);
   // If there is just one block, no planning can be done. Avoid it!
+  block_index_t first_block_index = block_buffer_tail;
   if (block_index != block_buffer_planned) {
-    reverse_pass();
-    forward_pass();
+    first_block_index = reverse_pass();
+    forward_pass(first_block_index);
   }
-  recalculate_trapezoids();
+  recalculate_trapezoids(first_block_index);
 }
 
 #if HAS_FAN && DISABLED(LASER_SYNCHRONOUS_M106_M107)
@@ -1343,7 +1595,11 @@ void Planner::check_axes_activity() {
     #endif
 
     #if ANY(DISABLE_X, DISABLE_Y, DISABLE_Z, DISABLE_E)
-      for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
+      // Released blocks may still be stepping out of the step schedule
+      #if ENABLED(STEP_SCHEDULE)
+        if (scheduled_block_count != stepped_block_count) LOOP_LOGICAL_AXES(i) axis_active[i] = true;
+      #endif
+      for (block_index_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
         block_t *block = &block_buffer[b];
         LOGICAL_AXIS_CODE(
           if (TERN0(DISABLE_E, block->steps.e)) axis_active.e = true,
@@ -1443,7 +1699,7 @@ void Planner::check_axes_activity() {
     if (thermalManager.degTargetHotend(active_extruder) < autotemp_min - 2) return; // Below the min?
 
     float high = 0.0;
-    for (uint8_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
+    for (block_index_t b = block_buffer_tail; b != block_buffer_head; b = next_block_index(b)) {
       block_t *block = &block_buffer[b];
       if (block->steps.x || block->steps.y || block->steps.z) {
         const float se = (float)block->steps.e / block->step_event_count * SQRT(block->nominal_speed_sqr); // mm/sec;
@@ -1743,6 +1999,7 @@ float Planner::get_axis_position_mm(const AxisEnum axis) {
  */
 void Planner::synchronize() {
   while (has_blocks_queued() || cleaning_buffer_counter
+      || TERN0(HAS_SHAPING, stepper.shaping_busy())
       || TERN0(EXTERNAL_CLOSED_LOOP_CONTROLLER, CLOSED_LOOP_WAITING())
   ) idle();
 }
@@ -1764,10 +2021,12 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   OPTARG(HAS_POSITION_FLOAT, const xyze_pos_t &target_float)
   OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
   , feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters
+  OPTARG(NATIVE_ARC_BLOCKS, const arc_move_t * const arc)
+  OPTARG(STEPPER_LEVELING, const level_move_t * const level)
 ) {
 
   // Wait for the next available block
-  uint8_t next_buffer_head;
+  block_index_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
 
   // If we are cleaning, do not accept queuing of movements
@@ -1784,6 +2043,8 @@ bool Planner::_buffer_steps(const xyze_long_t &target
       , cart_dist_mm
     #endif
     , fr_mm_s, extruder, millimeters
+    OPTARG(NATIVE_ARC_BLOCKS, arc)
+    OPTARG(STEPPER_LEVELING, level)
   )) {
     // Movement was not queued, probably because it was too short.
     //  Simply accept that as movement queued and done
@@ -1804,7 +2065,11 @@ bool Planner::_buffer_steps(const xyze_long_t &target
   block_buffer_head = next_buffer_head;
 
   // Recalculate and optimize trapezoidal speed profiles
-  recalculate();
+  #ifdef HAL_PLANNER_PROFILE
+    HAL_PLANNER_PROFILE(recalculate());
+  #else
+    recalculate();
+  #endif
 
   // Movement successfully queued!
   return true;
@@ -1818,6 +2083,8 @@ bool Planner::_buffer_steps(const xyze_long_t &target
  *  target      - target position in steps units
  *  fr_mm_s     - (target) speed of the move
  *  extruder    - target extruder
+ *  arc         - the arc to trace, for an arc block
+ *  level       - the leveled Z to follow, for a leveled block
  *
  * Returns true if movement is acceptable, false otherwise
  */
@@ -1826,6 +2093,8 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   OPTARG(HAS_POSITION_FLOAT, const xyze_pos_t &target_float)
   OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
   , feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters/*=0.0*/
+  OPTARG(NATIVE_ARC_BLOCKS, const arc_move_t * const arc/*=nullptr*/)
+  OPTARG(STEPPER_LEVELING, const level_move_t * const level/*=nullptr*/)
 ) {
   int32_t LOGICAL_AXIS_LIST(
     de = target.e - position.e,
@@ -1954,6 +2223,46 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     block->steps.set(LINEAR_AXIS_LIST(ABS(da), ABS(db), ABS(dc)));
   #endif
 
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    // On an arc both axes of the plane may move at the full speed
+    if (arc) {
+      block->steps[arc->block.axis_p] = CEIL(arc->flat_mm * arc->block.steps_per_mm_p);
+      block->steps[arc->block.axis_q] = CEIL(arc->flat_mm * arc->block.steps_per_mm_q);
+    }
+  #endif
+
+  #if ENABLED(STEPPER_LEVELING)
+    // A leveled block moves Z piece by piece. Every piece needs an event for each of its
+    // Z steps, and Z is planned at its steepest slope so the axis limits hold throughout.
+    block->level.pieces = 0;
+    if (level) {
+      block_level_t &bl = block->level;
+      bl.pieces = level->pieces;
+      const uint8_t last = bl.pieces - 1;
+
+      float events = _MAX(esteps, block->steps.a, block->steps.b, block->steps.c), t0 = 0;
+      int32_t z0 = 0;
+      LOOP_L_N(i, bl.pieces) {
+        bl.z[i] = i == last ? dc : int32_t(LROUND(level->z[i] * settings.axis_steps_per_mm[Z_AXIS])) - position.z;
+        NOLESS(events, (ABS(bl.z[i] - z0) + 2) / (level->t[i] - t0));
+        t0 = level->t[i];
+        z0 = bl.z[i];
+      }
+
+      const uint32_t count = CEIL(events);
+      uint32_t e0 = 0, slope = 0;
+      z0 = 0;
+      LOOP_L_N(i, bl.pieces) {
+        bl.events[i] = i == last ? count : uint32_t(LROUND(level->t[i] * count));
+        const uint32_t pe = bl.events[i] - e0;
+        NOLESS(slope, uint32_t((uint64_t(ABS(bl.z[i] - z0)) * count + pe - 1) / pe));
+        e0 = bl.events[i];
+        z0 = bl.z[i];
+      }
+      block->steps.c = slope;
+    }
+  #endif
+
   /**
    * This part of the code calculates the total length of the movement.
    * For cartesian bots, the X_AXIS is the real X movement and same for Y_AXIS.
@@ -2001,6 +2310,14 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     );
   #endif
 
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    if (arc) steps_dist_mm[arc->block.axis_p] = steps_dist_mm[arc->block.axis_q] = arc->flat_mm;
+  #endif
+
+  #if ENABLED(STEPPER_LEVELING)
+    if (level) steps_dist_mm.c = (dc < 0 ? -1.0f : 1.0f) * block->steps.c * steps_to_mm[C_AXIS];
+  #endif
+
   #if HAS_EXTRUDERS
     steps_dist_mm.e = esteps_float * steps_to_mm[E_AXIS_N(extruder)];
   #endif
@@ -2058,6 +2375,30 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
     esteps, block->steps.a, block->steps.b, block->steps.c
   ));
 
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    if (arc) {
+      block->flag |= BLOCK_FLAG_IS_ARC;
+      block_arc_t &ba = block->arc;
+      ba = arc->block;
+      ba.delta_p = target[ba.axis_p] - position[ba.axis_p];
+      ba.delta_q = target[ba.axis_q] - position[ba.axis_q];
+
+      // Every chord needs an event for each step of every axis. In the plane that's
+      // the steps along the chord, plus some for rounding and the last chord's snap.
+      const uint32_t n = ba.chords;
+      ba.chord_events = _MAX(
+        uint32_t(arc->flat_mm / n * _MAX(ba.steps_per_mm_p, ba.steps_per_mm_q)) + 2,
+        (block->steps[ba.axis_l] + n - 1) / n,
+        (esteps + n - 1) / n
+      );
+      block->step_event_count = ba.chord_events * n;
+    }
+  #endif
+
+  #if ENABLED(STEPPER_LEVELING)
+    if (level) block->step_event_count = block->level.events[block->level.pieces - 1];
+  #endif
+
   // Bail if this is a zero-length block
   if (block->step_event_count < MIN_STEPS_PER_SEGMENT) return false;
 
@@ -2161,7 +2502,7 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   float inverse_secs = fr_mm_s * inverse_millimeters;
 
   // Get the number of non busy movements in queue (non busy means that they can be altered)
-  const uint8_t moves_queued = nonbusy_movesplanned();
+  const block_index_t moves_queued = nonbusy_movesplanned();
 
   // Slow down when the buffer starts to empty, rather than wait at the corner for a buffer refill
   #if EITHER(SLOWDOWN, HAS_WIRED_LCD) || defined(XY_FREQUENCY_LIMIT)
@@ -2344,9 +2685,10 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
           #if IS_KINEMATIC
             block->millimeters
           #else
+            (TERN0(NATIVE_ARC_BLOCKS, arc) ? block->millimeters :
             SQRT(sq(target_float.x - position_float.x)
                + sq(target_float.y - position_float.y)
-               + sq(target_float.z - position_float.z))
+               + sq(target_float.z - position_float.z)))
           #endif
         ;
 
@@ -2383,7 +2725,36 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
   }
   block->acceleration_steps_per_s2 = accel;
   block->acceleration = accel / steps_per_mm;
-  #if DISABLED(S_CURVE_ACCELERATION)
+
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    // Direction of travel at both ends of an arc, in mm per mm
+    xyze_float_t arc_entry_dir, arc_exit_dir;
+    if (arc) {
+      const block_arc_t &ba = block->arc;
+
+      // Limit the speed so the centripetal acceleration is within the acceleration
+      const float arc_speed_sqr = block->acceleration * arc->radius;
+      if (block->nominal_speed_sqr > arc_speed_sqr) {
+        const float factor = SQRT(arc_speed_sqr / block->nominal_speed_sqr);
+        block->nominal_rate = _MAX(1U, uint32_t(block->nominal_rate * factor));
+        block->nominal_speed_sqr = arc_speed_sqr;
+      }
+
+      // Tangents at the start and end of the arc, turning as the arc turns
+      const float tk = (ba.sin_t < 0 ? -1.0f : 1.0f) * arc->flat_mm * inverse_millimeters / arc->radius,
+                  end_p = ba.rvec_p + ba.delta_p / ba.steps_per_mm_p,
+                  end_q = ba.rvec_q + ba.delta_q / ba.steps_per_mm_q;
+      arc_entry_dir = steps_dist_mm * inverse_millimeters;
+      arc_exit_dir = arc_entry_dir;
+      arc_entry_dir[ba.axis_p] = -tk * ba.rvec_q;
+      arc_entry_dir[ba.axis_q] =  tk * ba.rvec_p;
+      arc_exit_dir[ba.axis_p] = -tk * end_q;
+      arc_exit_dir[ba.axis_q] =  tk * end_p;
+
+      current_speed = arc_entry_dir * SQRT(block->nominal_speed_sqr);
+    }
+  #endif
+  #if DISABLED(HAS_BEZIER_S_CURVE)
     block->acceleration_rate = (uint32_t)(accel * (sq(4096.0f) / (STEPPER_TIMER_RATE)));
   #endif
   #if ENABLED(LIN_ADVANCE)
@@ -2452,11 +2823,67 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
      * => normalize the complete junction vector.
      * Elsewise, when needed JD will factor-in the E component
      */
+    #if ENABLED(NATIVE_ARC_BLOCKS)
+      if (arc) {
+        unit_vec = arc_entry_dir;           // Arcs join along their tangents
+        if (esteps > 0) normalize_junction_vector(unit_vec);
+      }
+      else
+    #endif
     if (EITHER(IS_CORE, MARKFORGED_XY) || esteps > 0)
       normalize_junction_vector(unit_vec);  // Normalize with XYZE components
     else
       unit_vec *= inverse_millimeters;      // Use pre-calculated (1 / SQRT(x^2 + y^2 + z^2))
 
+    #ifdef JD_CURVATURE_WINDOW
+      /**
+       * On a curve made of many short segments each junction turns so little
+       * that junction deviation allows speeds the curve as a whole can't take.
+       * Estimate the curvature over the last few short blocks as the angle
+       * turned over the distance between the first and last block midpoints,
+       * then limit the nominal speed so the centripetal acceleration stays
+       * within the block acceleration, as for arcs.
+       */
+      static float curve_mm[JD_CURVATURE_WINDOW],   // Recent short block lengths (ring)
+                   curve_turn[JD_CURVATURE_WINDOW]; // ...and the angle turned entering each one
+      static uint8_t curve_head, curve_count;
+
+      // Angle turned from the previous block (2 sin(θ/2) ~ θ for the small angles of interest)
+      const float turn = (unit_vec - prev_unit_vec).magnitude();
+      const bool curve_block = block->millimeters <= JD_CURVATURE_SEGMENT_MM && !TERN0(NATIVE_ARC_BLOCKS, arc);
+
+      if (!curve_block || !moves_queued || UNEAR_ZERO(previous_nominal_speed_sqr)
+        || turn > 0.765f  // Corners over 45° are left to junction deviation
+      ) curve_count = 0;  // Start a new curve
+      else if (curve_count) {
+        // Walk back to the oldest block adding up the distance and the turning
+        uint8_t i = curve_head;
+        float curve_len = 0.5f * block->millimeters, curve_angle = turn;
+        LOOP_L_N(n, curve_count) {
+          i = (i ? i : JD_CURVATURE_WINDOW) - 1;
+          curve_len += curve_mm[i];
+          if (n < curve_count - 1) curve_angle += curve_turn[i];
+        }
+        curve_len -= 0.5f * curve_mm[i];
+
+        if (curve_angle > 0.001f) {
+          const float curve_speed_sqr = block->acceleration * curve_len / curve_angle; // v^2 = a * r
+          if (block->nominal_speed_sqr > curve_speed_sqr) {
+            const float factor = SQRT(curve_speed_sqr / block->nominal_speed_sqr);
+            block->nominal_rate = _MAX(1U, uint32_t(block->nominal_rate * factor));
+            block->nominal_speed_sqr = curve_speed_sqr;
+          }
+        }
+      }
+
+      if (curve_block) {
+        curve_mm[curve_head] = block->millimeters;
+        curve_turn[curve_head] = turn;
+        if (++curve_head == JD_CURVATURE_WINDOW) curve_head = 0;
+        if (curve_count < JD_CURVATURE_WINDOW - 1) curve_count++;
+      }
+    #endif
+
     // Skip first block or when previous_nominal_speed is used as a flag for homing and offset cycles.
     if (moves_queued && !UNEAR_ZERO(previous_nominal_speed_sqr)) {
       // Compute cosine of angle between previous and current path. (prev_unit_vec is negative)
@@ -2582,6 +3009,13 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
     prev_unit_vec = unit_vec;
 
+    #if ENABLED(NATIVE_ARC_BLOCKS)
+      if (arc) {
+        prev_unit_vec = arc_exit_dir;
+        if (esteps > 0) normalize_junction_vector(prev_unit_vec);
+      }
+    #endif
+
   #endif
 
   #ifdef USE_CACHED_SQRT
@@ -2693,15 +3127,24 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
   #endif // Classic Jerk Limiting
 
-  // Max entry speed of this block equals the max exit speed of the previous block.
-  block->max_entry_speed_sqr = vmax_junction_sqr;
-
   // Initialize block entry speed. Compute based on deceleration to user-defined MINIMUM_PLANNER_SPEED.
-  const float v_allowable_sqr = max_allowable_speed_sqr(-block->acceleration, sq(float(MINIMUM_PLANNER_SPEED)), block->millimeters);
+  const float v_allowable_sqr = TERN(S_CURVE_JERK_LIMITED, entry_speed_sqr_limit(block, min_speed_sqr()),
+                                     max_allowable_speed_sqr(-block->acceleration, sq(float(MINIMUM_PLANNER_SPEED)), block->millimeters));
+
+  #if ENABLED(PLANNER_FIXED_POINT)
+    // From here on the lookahead only needs the speeds in fixed point
+    block->fixed_nominal_speed_sqr = to_speed_sqr(block->nominal_speed_sqr);
+    block->accel_distance_sqr = to_speed_sqr(2 * block->acceleration * block->millimeters);
+    block->max_entry_speed_sqr = to_speed_sqr(vmax_junction_sqr);
+    block->entry_speed_sqr = !split_move ? min_speed_sqr() : to_speed_sqr(_MIN(vmax_junction_sqr, v_allowable_sqr));
+  #else
+    // Max entry speed of this block equals the max exit speed of the previous block.
+    block->max_entry_speed_sqr = vmax_junction_sqr;
 
-  // If we are trying to add a split block, start with the
-  // max. allowed speed to avoid an interrupted first move.
-  block->entry_speed_sqr = !split_move ? sq(float(MINIMUM_PLANNER_SPEED)) : _MIN(vmax_junction_sqr, v_allowable_sqr);
+    // If we are trying to add a split block, start with the
+    // max. allowed speed to avoid an interrupted first move.
+    block->entry_speed_sqr = !split_move ? sq(float(MINIMUM_PLANNER_SPEED)) : _MIN(vmax_junction_sqr, v_allowable_sqr);
+  #endif
 
   // Initialize planner efficiency flags
   // Set flag if block will always reach maximum junction speed regardless of entry/exit speeds.
@@ -2715,6 +3158,9 @@ bool Planner::_populate_block(block_t * const block, bool split_move,
 
   // Update previous path unit_vector and nominal speed
   previous_speed = current_speed;
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    if (arc) previous_speed = arc_exit_dir * SQRT(block->nominal_speed_sqr);
+  #endif
   previous_nominal_speed_sqr = block->nominal_speed_sqr;
 
   position = target;  // Update the position
@@ -2738,7 +3184,7 @@ void Planner::buffer_sync_block(TERN_(LASER_SYNCHRONOUS_M106_M107, uint8_t sync_
   #endif
 
   // Wait for the next available block
-  uint8_t next_buffer_head;
+  block_index_t next_buffer_head;
   block_t * const block = get_next_free_block(next_buffer_head);
 
   // Clear block
@@ -2785,6 +3231,8 @@ bool Planner::buffer_segment(
   LOGICAL_AXIS_LIST(const_float_t e, const_float_t a, const_float_t b, const_float_t c)
   OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
   , const_feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters/*=0.0*/
+  OPTARG(NATIVE_ARC_BLOCKS, const arc_move_t * const arc/*=nullptr*/)
+  OPTARG(STEPPER_LEVELING, const level_move_t * const level/*=nullptr*/)
 ) {
 
   // If we are cleaning, do not accept queuing of movements
@@ -2860,7 +3308,9 @@ bool Planner::buffer_segment(
       #if HAS_DIST_MM_ARG
         , cart_dist_mm
       #endif
-      , fr_mm_s, extruder, millimeters)
+      , fr_mm_s, extruder, millimeters
+      OPTARG(NATIVE_ARC_BLOCKS, arc)
+      OPTARG(STEPPER_LEVELING, level))
   ) return false;
 
   stepper.wake_up();
@@ -2877,11 +3327,13 @@ bool Planner::buffer_segment(
  *  extruder     - target extruder
  *  millimeters  - the length of the movement, if known
  *  inv_duration - the reciprocal if the duration of the movement, if known (kinematic only if feeedrate scaling is enabled)
+ *  line_ik      - the straight line this segment is stepping along, if any (delta only)
  */
 bool Planner::buffer_line(
   LOGICAL_AXIS_LIST(const_float_t e, const_float_t rx, const_float_t ry, const_float_t rz)
   , const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters
   OPTARG(SCARA_FEEDRATE_SCALING, const_float_t inv_duration)
+  OPTARG(DELTA_INCREMENTAL_IK, DeltaLineIK * const line_ik)
 ) {
   xyze_pos_t machine = LOGICAL_AXIS_ARRAY(e, rx, ry, rz);
   TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
@@ -2902,6 +3354,9 @@ bool Planner::buffer_line(
       mm = (cart_dist_mm.x != 0.0 || cart_dist_mm.y != 0.0) ? cart_dist_mm.magnitude() : ABS(cart_dist_mm.z);
 
     // Cartesian XYZ to kinematic ABC, stored in global 'delta'
+    #if ENABLED(DELTA_INCREMENTAL_IK)
+      if (line_ik) line_ik->next(); else
+    #endif
     inverse_kinematics(machine);
 
     #if ENABLED(SCARA_FEEDRATE_SCALING)
@@ -2929,6 +3384,109 @@ bool Planner::buffer_line(
   #endif
 } // buffer_line()
 
+#if ENABLED(NATIVE_ARC_BLOCKS)
+
+  /**
+   * Add an arc to the buffer as a single block, traced by the Stepper ISR.
+   * See planner.h for the parameters.
+   */
+  bool Planner::buffer_arc(const xyze_pos_t &cart, const AxisEnum p_axis, const AxisEnum q_axis,
+    const ab_float_t &rvec, const_float_t angular_travel, const_float_t millimeters,
+    const_feedRate_t fr_mm_s, const uint8_t extruder
+  ) {
+    xyze_pos_t machine = cart;
+    TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine, false));
+
+    arc_move_t arc;
+    arc.radius = HYPOT(rvec.a, rvec.b);
+    arc.flat_mm = arc.radius * ABS(angular_travel);
+
+    block_arc_t &ba = arc.block;
+    ba.axis_p = p_axis;
+    ba.axis_q = q_axis;
+    ba.axis_l = X_AXIS + Y_AXIS + Z_AXIS - p_axis - q_axis;
+
+    // Keep the chords within half a step of the arc: r * (1 - cos(theta / 2)) <= step / 2
+    const float tolerance = 0.5f * _MIN(steps_to_mm[p_axis], steps_to_mm[q_axis]),
+                max_theta = 2.0f * acosf(_MAX(1.0f - tolerance / arc.radius, 0.0f));
+    ba.chords = _MAX(1U, uint32_t(CEIL(ABS(angular_travel) / max_theta)));
+
+    const float theta = angular_travel / ba.chords;
+    ba.cos_t = cosf(theta);
+    ba.sin_t = sinf(theta);
+    ba.rvec_p = rvec.a;
+    ba.rvec_q = rvec.b;
+    ba.inv_radius_sqr = RECIPROCAL(sq(arc.radius));
+    ba.steps_per_mm_p = settings.axis_steps_per_mm[p_axis];
+    ba.steps_per_mm_q = settings.axis_steps_per_mm[q_axis];
+
+    return buffer_segment(
+      LOGICAL_AXIS_LIST(machine.e, machine.x, machine.y, machine.z)
+      , fr_mm_s, extruder, millimeters, &arc
+    );
+  }
+
+#endif // NATIVE_ARC_BLOCKS
+
+#if ENABLED(STEPPER_LEVELING)
+
+  /**
+   * Add a leveled line to the buffer, split only where a block would
+   * cross more than LEVELING_BLOCK_PIECES mesh cells.
+   * See planner.h for the parameters.
+   */
+  bool Planner::buffer_leveled_line(const xyze_pos_t &start, const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder) {
+    const xyze_float_t diff = cart - start;
+
+    // Where the line crosses the grid lines, as fractions of the line. Drop the
+    // crossings too close to others to give their pieces a couple of steps.
+    const float mm = xyz_float_t(diff).magnitude(),
+                min_t = mm ? 2 * _MAX(steps_to_mm[X_AXIS], steps_to_mm[Y_AXIS]) / mm : 1;
+    float cross[GRID_MAX_POINTS_X + GRID_MAX_POINTS_Y + 1];
+    uint8_t n = 0;
+    const auto add_crossing = [&](const_float_t t) {
+      if (t < min_t || t > 1 - min_t) return;
+      uint8_t i = n;
+      for (; i && cross[i - 1] > t; --i) cross[i] = cross[i - 1];
+      cross[i] = t;
+      n++;
+    };
+    if (diff.x) LOOP_L_N(i, GRID_MAX_POINTS_X) add_crossing((_GET_MESH_X(i) - start.x) / diff.x);
+    if (diff.y) LOOP_L_N(j, GRID_MAX_POINTS_Y) add_crossing((_GET_MESH_Y(j) - start.y) / diff.y);
+
+    uint8_t pieces = 0;
+    LOOP_L_N(i, n) if (!pieces || cross[i] - cross[pieces - 1] >= min_t) cross[pieces++] = cross[i];
+    cross[pieces++] = 1;
+
+    // Within a single cell there's nothing to follow
+    if (pieces == 1) return buffer_line(cart, fr_mm_s, extruder);
+
+    // Fill blocks with pieces, each ending with the leveled Z at a grid line
+    level_move_t level;
+    float t0 = 0;
+    for (uint8_t first = 0; first < pieces; first += level.pieces) {
+      level.pieces = _MIN(pieces - first, LEVELING_BLOCK_PIECES);
+      const float t1 = cross[first + level.pieces - 1];
+      xyze_pos_t machine;
+      LOOP_L_N(i, level.pieces) {
+        const float t = cross[first + i];
+        machine = t < 1 ? start + diff * t : cart;
+        TERN_(HAS_POSITION_MODIFIERS, apply_modifiers(machine));
+        level.t[i] = (t - t0) / (t1 - t0);
+        level.z[i] = machine.z;
+      }
+      if (!buffer_segment(
+        LOGICAL_AXIS_LIST(machine.e, machine.x, machine.y, machine.z)
+        , fr_mm_s, extruder, mm * (t1 - t0)
+        OPTARG(NATIVE_ARC_BLOCKS, nullptr), &level
+      )) return false;
+      t0 = t1;
+    }
+    return true;
+  }
+
+#endif // STEPPER_LEVELING
+
 #if ENABLED(DIRECT_STEPPING)
 
   void Planner::buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps) {
@@ -2937,7 +3495,7 @@ bool Planner::buffer_line(
       return;
     }
 
-    uint8_t next_buffer_head;
+    block_index_t next_buffer_head;
     block_t * const block = get_next_free_block(next_buffer_head);
 
     block->flag = BLOCK_FLAG_IS_PAGE;
@@ -66,6 +66,12 @@
   #include "../feature/spindle_laser_types.h"
 #endif
 
+#include "../libs/ring_index.h"
+
+#if ENABLED(PLANNER_FIXED_POINT)
+  #include "../libs/fixedpoint.h"
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
   #include "../feature/direct_stepping.h"
   #define IS_PAGE(B) TEST(B->flag, BLOCK_BIT_IS_PAGE)
@@ -98,6 +104,11 @@ enum BlockFlagBit : char {
   // Sync the stepper counts from the block
   BLOCK_BIT_SYNC_POSITION
 
+  // Arc traced by the Stepper ISR
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    , BLOCK_BIT_IS_ARC
+  #endif
+
   // Direct stepping page
   #if ENABLED(DIRECT_STEPPING)
     , BLOCK_BIT_IS_PAGE
@@ -114,6 +125,9 @@ enum BlockFlag : char {
   , BLOCK_FLAG_NOMINAL_LENGTH       = _BV(BLOCK_BIT_NOMINAL_LENGTH)
   , BLOCK_FLAG_CONTINUED            = _BV(BLOCK_BIT_CONTINUED)
   , BLOCK_FLAG_SYNC_POSITION        = _BV(BLOCK_BIT_SYNC_POSITION)
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    , BLOCK_FLAG_IS_ARC             = _BV(BLOCK_BIT_IS_ARC)
+  #endif
   #if ENABLED(DIRECT_STEPPING)
     , BLOCK_FLAG_IS_PAGE            = _BV(BLOCK_BIT_IS_PAGE)
   #endif
@@ -148,6 +162,63 @@ enum BlockFlag : char {
 
 #endif
 
+#if ENABLED(NATIVE_ARC_BLOCKS)
+
+  /**
+   * An arc for the Stepper ISR to trace, one chord at a time.
+   * The chords are short enough to stay within half a step of the true arc.
+   * The linear axis and E move evenly over the chords.
+   */
+  typedef struct {
+    uint8_t axis_p, axis_q, axis_l;         // The axes of the arc plane, and the linear axis
+    uint32_t chords,                        // The number of chords
+             chord_events;                  // The step events in each chord
+    float rvec_p, rvec_q,                   // Radius vector from the center to the start (mm)
+          cos_t, sin_t,                     // Rotation of the radius vector for each chord
+          inv_radius_sqr,                   // Keeps the length of the radius vector from drifting
+          steps_per_mm_p, steps_per_mm_q;
+    int32_t delta_p, delta_q;               // Steps from the start to the end of the arc
+  } block_arc_t;
+
+  // An arc on its way into the planner
+  typedef struct {
+    block_arc_t block;
+    float radius, flat_mm;                  // (mm) The radius, and the length in the arc plane
+  } arc_move_t;
+
+#endif
+
+#if ENABLED(STEPPER_LEVELING)
+
+  /**
+   * The leveled Z of a block, for the Stepper ISR to follow piece by piece.
+   * Each piece ends where the move crosses a mesh grid line, or at the end of the block.
+   */
+  typedef struct {
+    uint8_t pieces;                         // The number of pieces (0 for a plain block)
+    uint32_t events[LEVELING_BLOCK_PIECES]; // The step event that ends each piece
+    int32_t z[LEVELING_BLOCK_PIECES];       // Z steps from the start of the block to the end of each piece
+  } block_level_t;
+
+  // A leveled move on its way into the planner
+  typedef struct {
+    uint8_t pieces;
+    float t[LEVELING_BLOCK_PIECES],         // The end of each piece, as a fraction of the move
+          z[LEVELING_BLOCK_PIECES];         // (mm) The leveled Z at the end of each piece
+  } level_move_t;
+
+#endif
+
+#if ENABLED(PLANNER_FIXED_POINT)
+  // Squared speeds for the lookahead in (mm/sec)^2 with 8 fractional bits.
+  // Q16.16 would overflow above 181mm/s, so these trade fraction bits for range.
+  typedef uint32_t speed_sqr_t;
+  #define SPEED_SQR_SHIFT 8
+  #define SPEED_SQR_MAX   0x7FFFFFFFUL        // Keeps the sum of two in range
+#else
+  typedef float speed_sqr_t;
+#endif
+
 /**
  * struct block_t
  *
@@ -163,11 +234,17 @@ typedef struct block_t {
 
   // Fields used by the motion planner to manage acceleration
   float nominal_speed_sqr,                  // The nominal speed for this block in (mm/sec)^2
-        entry_speed_sqr,                    // Entry speed at previous-current junction in (mm/sec)^2
-        max_entry_speed_sqr,                // Maximum allowable junction entry speed in (mm/sec)^2
         millimeters,                        // The total travel of this block in mm
         acceleration;                       // acceleration mm/sec^2
 
+  speed_sqr_t entry_speed_sqr,              // Entry speed at previous-current junction in (mm/sec)^2
+              max_entry_speed_sqr;          // Maximum allowable junction entry speed in (mm/sec)^2
+
+  #if ENABLED(PLANNER_FIXED_POINT)
+    speed_sqr_t fixed_nominal_speed_sqr,    // nominal_speed_sqr for the lookahead
+                accel_distance_sqr;         // Change in speed^2 over the whole block (2 * acceleration * millimeters)
+  #endif
+
   union {
     abce_ulong_t steps;                     // Step count along each axis
     abce_long_t position;                   // New position to force when this sync block is executed
@@ -191,10 +268,17 @@ typedef struct block_t {
   #if ENABLED(S_CURVE_ACCELERATION)
     uint32_t cruise_rate,                   // The actual cruise rate to use, between end of the acceleration phase and start of deceleration phase
              acceleration_time,             // Acceleration time and deceleration time in STEP timer counts
-             deceleration_time,
-             acceleration_time_inverse,     // Inverse of acceleration and deceleration periods, expressed as integer. Scale depends on CPU being used
+             deceleration_time;
+  #endif
+  #if ENABLED(HAS_BEZIER_S_CURVE)
+    uint32_t acceleration_time_inverse,     // Inverse of acceleration and deceleration periods, expressed as integer. Scale depends on CPU being used
              deceleration_time_inverse;
-  #else
+  #elif ENABLED(S_CURVE_JERK_LIMITED)
+    uint32_t acceleration_jerk_time,        // Time spent changing the acceleration at each end of a ramp, in STEP timer counts
+             deceleration_jerk_time,
+             jerk_rate;                     // The jerk, scaled so that twice STEP_MULTIPLY by a time gives half the jerk times the time squared
+  #endif
+  #if DISABLED(HAS_BEZIER_S_CURVE)
     uint32_t acceleration_rate;             // The acceleration rate used for acceleration calculation
   #endif
 
@@ -218,6 +302,14 @@ typedef struct block_t {
     page_idx_t page_idx;                    // Page index used for direct stepping
   #endif
 
+  #if ENABLED(NATIVE_ARC_BLOCKS)
+    block_arc_t arc;                        // Arc to trace, if BLOCK_FLAG_IS_ARC is set
+  #endif
+
+  #if ENABLED(STEPPER_LEVELING)
+    block_level_t level;                    // Leveled Z to follow, if level.pieces is set
+  #endif
+
   #if HAS_CUTTER
     cutter_power_t cutter_power;            // Power level for Spindle, Laser, etc.
   #endif
@@ -248,7 +340,8 @@ typedef struct block_t {
   #define HAS_POSITION_FLOAT 1
 #endif
 
-#define BLOCK_MOD(n) ((n)&(BLOCK_BUFFER_SIZE-1))
+typedef RingIndex<BLOCK_BUFFER_SIZE> block_ring_t;
+typedef block_ring_t::type block_index_t;   // uint16_t for more than 256 blocks
 
 #if ENABLED(LASER_POWER_INLINE)
   typedef struct {
@@ -320,13 +413,18 @@ class Planner {
      *  Reader of tail is Stepper::isr(). Always consider tail busy / read-only
      */
     static block_t block_buffer[BLOCK_BUFFER_SIZE];
-    static volatile uint8_t block_buffer_head,      // Index of the next block to be pushed
-                            block_buffer_nonbusy,   // Index of the first non busy block
-                            block_buffer_planned,   // Index of the optimally planned block
-                            block_buffer_tail;      // Index of the busy block, if any
+    static volatile block_index_t block_buffer_head,      // Index of the next block to be pushed
+                                  block_buffer_nonbusy,   // Index of the first non busy block
+                                  block_buffer_planned,   // Index of the optimally planned block
+                                  block_buffer_tail;      // Index of the busy block, if any
     static uint16_t cleaning_buffer_counter;        // A counter to disable queuing of blocks
     static uint8_t delay_before_delivering;         // This counter delays delivery of blocks when queue becomes empty to allow the opportunity of merging blocks
 
+    #if ENABLED(STEP_SCHEDULE)
+      // Blocks released into the step schedule, and blocks the Stepper ISR has finished
+      static volatile uint16_t scheduled_block_count, stepped_block_count;
+    #endif
+
 
     #if ENABLED(DISTINCT_E_FACTORS)
       static uint8_t last_extruder;                 // Respond to extruder change
@@ -663,10 +761,10 @@ class Planner {
     #endif // HAS_POSITION_MODIFIERS
 
     // Number of moves currently in the planner including the busy block, if any
-    FORCE_INLINE static uint8_t movesplanned() { return BLOCK_MOD(block_buffer_head - block_buffer_tail); }
+    FORCE_INLINE static block_index_t movesplanned() { return block_ring_t::distance(block_buffer_tail, block_buffer_head); }
 
     // Number of nonbusy moves currently in the planner
-    FORCE_INLINE static uint8_t nonbusy_movesplanned() { return BLOCK_MOD(block_buffer_head - block_buffer_nonbusy); }
+    FORCE_INLINE static block_index_t nonbusy_movesplanned() { return block_ring_t::distance(block_buffer_nonbusy, block_buffer_head); }
 
     // Remove all blocks from the buffer
     FORCE_INLINE static void clear_block_buffer() { block_buffer_nonbusy = block_buffer_planned = block_buffer_head = block_buffer_tail = 0; }
@@ -675,7 +773,7 @@ class Planner {
     FORCE_INLINE static bool is_full() { return block_buffer_tail == next_block_index(block_buffer_head); }
 
     // Get count of movement slots free
-    FORCE_INLINE static uint8_t moves_free() { return BLOCK_BUFFER_SIZE - 1 - movesplanned(); }
+    FORCE_INLINE static block_index_t moves_free() { return BLOCK_BUFFER_SIZE - 1 - movesplanned(); }
 
     /**
      * Planner::get_next_free_block
@@ -684,7 +782,7 @@ class Planner {
      * - Wait for the number of spaces to open up in the planner
      * - Return the first head block
      */
-    FORCE_INLINE static block_t* get_next_free_block(uint8_t &next_buffer_head, const uint8_t count=1) {
+    FORCE_INLINE static block_t* get_next_free_block(block_index_t &next_buffer_head, const block_index_t count=1) {
 
       // Wait until there are enough slots free
       while (moves_free() < count) { idle(); }
@@ -710,6 +808,8 @@ class Planner {
       OPTARG(HAS_POSITION_FLOAT, const xyze_pos_t &target_float)
       OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
       , feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters=0.0
+      OPTARG(NATIVE_ARC_BLOCKS, const arc_move_t * const arc=nullptr)
+      OPTARG(STEPPER_LEVELING, const level_move_t * const level=nullptr)
     );
 
     /**
@@ -728,6 +828,8 @@ class Planner {
       OPTARG(HAS_POSITION_FLOAT, const xyze_pos_t &target_float)
       OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
       , feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters=0.0
+      OPTARG(NATIVE_ARC_BLOCKS, const arc_move_t * const arc=nullptr)
+      OPTARG(STEPPER_LEVELING, const level_move_t * const level=nullptr)
     );
 
     /**
@@ -762,6 +864,8 @@ class Planner {
       LOGICAL_AXIS_LIST(const_float_t e, const_float_t a, const_float_t b, const_float_t c)
       OPTARG(HAS_DIST_MM_ARG, const xyze_float_t &cart_dist_mm)
       , const_feedRate_t fr_mm_s, const uint8_t extruder, const_float_t millimeters=0.0
+      OPTARG(NATIVE_ARC_BLOCKS, const arc_move_t * const arc=nullptr)
+      OPTARG(STEPPER_LEVELING, const level_move_t * const level=nullptr)
     );
 
     FORCE_INLINE static bool buffer_segment(abce_pos_t &abce
@@ -792,18 +896,53 @@ class Planner {
       LOGICAL_AXIS_LIST(const_float_t e, const_float_t rx, const_float_t ry, const_float_t rz)
       , const feedRate_t &fr_mm_s, const uint8_t extruder, const float millimeters=0.0
       OPTARG(SCARA_FEEDRATE_SCALING, const_float_t inv_duration=0.0)
+      OPTARG(DELTA_INCREMENTAL_IK, DeltaLineIK * const line_ik=nullptr)
     );
 
     FORCE_INLINE static bool buffer_line(const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder, const float millimeters=0.0
       OPTARG(SCARA_FEEDRATE_SCALING, const_float_t inv_duration=0.0)
+      OPTARG(DELTA_INCREMENTAL_IK, DeltaLineIK * const line_ik=nullptr)
     ) {
       return buffer_line(
         LOGICAL_AXIS_LIST(cart.e, cart.x, cart.y, cart.z)
         , fr_mm_s, extruder, millimeters
         OPTARG(SCARA_FEEDRATE_SCALING, inv_duration)
+        OPTARG(DELTA_INCREMENTAL_IK, line_ik)
       );
     }
 
+    #if ENABLED(NATIVE_ARC_BLOCKS)
+      /**
+       * Add an arc to the buffer as a single block, traced by the Stepper ISR.
+       * Leveling is not applied, so only call this with leveling inactive.
+       *
+       *  cart           - target position in mm
+       *  p_axis, q_axis - the axes of the arc plane
+       *  rvec           - radius vector from the center to the current position
+       *  angular_travel - the angle to turn (radians), positive for counter-clockwise
+       *  millimeters    - the length of the arc, including the linear axis
+       *  fr_mm_s        - (target) speed of the move (mm/s)
+       *  extruder       - target extruder
+       */
+      static bool buffer_arc(const xyze_pos_t &cart, const AxisEnum p_axis, const AxisEnum q_axis,
+        const ab_float_t &rvec, const_float_t angular_travel, const_float_t millimeters,
+        const_feedRate_t fr_mm_s, const uint8_t extruder
+      );
+    #endif
+
+    #if ENABLED(STEPPER_LEVELING)
+      /**
+       * Add a leveled line to the buffer, in as few blocks as the
+       * mesh allows. The Stepper ISR applies the Z correction.
+       *
+       *  start    - the current position in mm
+       *  cart     - target position in mm
+       *  fr_mm_s  - (target) speed of the move (mm/s)
+       *  extruder - target extruder
+       */
+      static bool buffer_leveled_line(const xyze_pos_t &start, const xyze_pos_t &cart, const_feedRate_t fr_mm_s, const uint8_t extruder);
+    #endif
+
     #if ENABLED(DIRECT_STEPPING)
       static void buffer_page(const page_idx_t page_idx, const uint8_t extruder, const uint16_t num_steps);
     #endif
@@ -894,7 +1033,10 @@ class Planner {
     /**
      * Does the buffer have any blocks queued?
      */
-    FORCE_INLINE static bool has_blocks_queued() { return (block_buffer_head != block_buffer_tail); }
+    FORCE_INLINE static bool has_blocks_queued() {
+      return block_buffer_head != block_buffer_tail
+        || TERN0(STEP_SCHEDULE, scheduled_block_count != stepped_block_count); // Released, but still stepping
+    }
 
     /**
      * Get the current block for processing
@@ -911,7 +1053,7 @@ class Planner {
      * Called when the current block is no longer needed.
      */
     FORCE_INLINE static void release_current_block() {
-      if (has_blocks_queued())
+      if (block_buffer_head != block_buffer_tail)
         block_buffer_tail = next_block_index(block_buffer_tail);
     }
 
@@ -950,8 +1092,8 @@ class Planner {
     /**
      * Get the index of the next / previous block in the ring buffer
      */
-    static constexpr uint8_t next_block_index(const uint8_t block_index) { return BLOCK_MOD(block_index + 1); }
-    static constexpr uint8_t prev_block_index(const uint8_t block_index) { return BLOCK_MOD(block_index - 1); }
+    static constexpr block_index_t next_block_index(const block_index_t block_index) { return block_ring_t::next(block_index); }
+    static constexpr block_index_t prev_block_index(const block_index_t block_index) { return block_ring_t::prev(block_index); }
 
     /**
      * Calculate the distance (not time) it takes to accelerate
@@ -993,15 +1135,85 @@ class Planner {
       }
     #endif
 
-    static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
+    #if ENABLED(S_CURVE_JERK_LIMITED)
+      /**
+       * A constant-jerk ramp raises the acceleration to 'accel' with 'jerk', holds it,
+       * and brings it back to zero the same way. Ramps too short to reach 'accel' are
+       * two jerk phases only. The speed curve is symmetric about its middle, so the
+       * distance covered is the mean of the two speeds times the ramp time.
+       */
+      static float jerk_ramp_time(const_float_t speed_change, const_float_t accel, const_float_t jerk) {
+        return speed_change * jerk < sq(accel) ? 2 * SQRT(speed_change / jerk) : speed_change / accel + accel / jerk;
+      }
+
+      static float jerk_ramp_distance(const_float_t v0, const_float_t v1, const_float_t accel, const_float_t jerk) {
+        return (v0 + v1) * 0.5f * jerk_ramp_time(ABS(v1 - v0), accel, jerk);
+      }
+
+      // The highest speed that can ramp to or from 'v' within 'distance'
+      static float jerk_ramp_speed(const_float_t v, const_float_t distance, const_float_t accel, const_float_t jerk);
+
+      // The highest jerk (steps/s^3) that fits the stepper's jerk_rate
+      static constexpr float jerk_steps_max() { return float(STEPPER_TIMER_RATE) * float(STEPPER_TIMER_RATE) / 65536.0f; }
+
+      static float jerk_mm_per_s3(const block_t * const block) {
+        return _MIN(float(S_CURVE_MAX_JERK), jerk_steps_max() * block->millimeters / block->step_event_count);
+      }
+    #endif
+
+    #if ENABLED(PLANNER_FIXED_POINT)
+
+      static speed_sqr_t to_speed_sqr(const_float_t v2) {
+        return v2 <= 0 ? 0 : v2 >= float(SPEED_SQR_MAX >> SPEED_SQR_SHIFT) ? SPEED_SQR_MAX : speed_sqr_t(v2 * (1UL << SPEED_SQR_SHIFT) + 0.5f);
+      }
+      static float from_speed_sqr(const speed_sqr_t v2) { return v2 * (1.0f / (1UL << SPEED_SQR_SHIFT)); }
+
+      static constexpr speed_sqr_t min_speed_sqr() { return speed_sqr_t(sq(float(MINIMUM_PLANNER_SPEED)) * (1UL << SPEED_SQR_SHIFT) + 0.5f); }
+
+      /**
+       * The fixed-point max_allowable_speed_sqr: the highest entry speed^2 that
+       * can still slow down to 'exit_speed_sqr' over the length of the block.
+       */
+      static speed_sqr_t entry_speed_sqr_limit(const block_t * const block, const speed_sqr_t exit_speed_sqr) {
+        return _MIN(exit_speed_sqr + block->accel_distance_sqr, SPEED_SQR_MAX);
+      }
+
+      static void calculate_trapezoid_for_block(block_t * const block, const speed_sqr_t entry_speed_sqr, const speed_sqr_t exit_speed_sqr);
+
+      #if ENABLED(PLANNER_FIXED_POINT_CHECK)
+        static void check_fixed_trapezoid(const block_t * const block, const speed_sqr_t entry_speed_sqr, const speed_sqr_t exit_speed_sqr);
+      #endif
+
+    #else
+
+      static constexpr float min_speed_sqr() { return sq(float(MINIMUM_PLANNER_SPEED)); }
+
+      static float entry_speed_sqr_limit(const block_t * const block, const_float_t exit_speed_sqr) {
+        #if ENABLED(S_CURVE_JERK_LIMITED)
+          return sq(jerk_ramp_speed(SQRT(exit_speed_sqr), block->millimeters, block->acceleration, jerk_mm_per_s3(block)));
+        #else
+          return max_allowable_speed_sqr(-block->acceleration, exit_speed_sqr, block->millimeters);
+        #endif
+      }
+
+    #endif
+
+    #if DISABLED(PLANNER_FIXED_POINT) || ENABLED(PLANNER_FIXED_POINT_CHECK)
+      static void calculate_trapezoid_for_block(block_t * const block, const_float_t entry_factor, const_float_t exit_factor);
+    #endif
 
     static void reverse_pass_kernel(block_t * const current, const block_t * const next);
-    static void forward_pass_kernel(const block_t * const previous, block_t * const current, uint8_t block_index);
+    static void forward_pass_kernel(const block_t * const previous, block_t * const current, const block_index_t block_index);
 
-    static void reverse_pass();
-    static void forward_pass();
+    static block_index_t reverse_pass();
+    static void forward_pass(const block_index_t first_block_index);
 
-    static void recalculate_trapezoids();
+    static void recalculate_trapezoids(const block_index_t first_block_index);
+
+    // True if block_index is at or after first_index and before block_buffer_head
+    FORCE_INLINE static bool block_index_in_range(const block_index_t block_index, const block_index_t first_index) {
+      return block_ring_t::distance(block_index, block_buffer_head) <= block_ring_t::distance(first_index, block_buffer_head);
+    }
 
     static void recalculate();
 
@@ -40,7 +40,12 @@
 // See the meaning in the documentation of cubic_b_spline().
 #define MIN_STEP 0.002f
 #define MAX_STEP 0.1f
-#define SIGMA 0.1f
+#if HAS_CHORDAL_TOLERANCE
+  #include "chordal.h"
+  #define SIGMA segmenter.tolerance
+#else
+  #define SIGMA 0.1f
+#endif
 
 // Compute the linear interpolation between two real numbers.
 static inline float interp(const_float_t a, const_float_t b, const_float_t t) { return (1 - t) * a + t * b; }
@@ -85,7 +90,9 @@ static inline float dist1(const_float_t x1, const_float_t y1, const_float_t x2,
  * following test is performed: the distance between eval_bezier(...,
  * t+step/2) is evaluated and compared with 0.5*(eval_bezier(...,
  * t)+eval_bezier(..., t+step)). If it is smaller than SIGMA, then the
- * step value is considered acceptable, otherwise it is not. The code
+ * step value is considered acceptable, otherwise it is not. (With
+ * CHORDAL_TOLERANCE, SIGMA is the M214 tolerance and the step is also
+ * never reduced below the length the planner needs to keep up.) The code
  * seeks to find the larger step value which is considered acceptable.
  *
  * At every iteration the recorded step value is considered and then
@@ -137,8 +144,14 @@ void cubic_b_spline(
     NOMORE(new_t, 1);
     float new_pos0 = eval_bezier(position.x, first.x, second.x, target.x, new_t),
           new_pos1 = eval_bezier(position.y, first.y, second.y, target.y, new_t);
+    #if HAS_CHORDAL_TOLERANCE
+      const float min_length = segmenter.min_length(scaled_fr_mm_s);
+    #endif
     for (;;) {
       if (new_t - t < (MIN_STEP)) break;
+      #if HAS_CHORDAL_TOLERANCE
+        if (dist1(bez_target.x, bez_target.y, new_pos0, new_pos1) < 2 * min_length) break; // Halving would starve the planner
+      #endif
       const float candidate_t = 0.5f * (t + new_t),
                   candidate_pos0 = eval_bezier(position.x, first.x, second.x, target.x, candidate_t),
                   candidate_pos1 = eval_bezier(position.y, first.y, second.y, target.y, candidate_t),
@@ -196,7 +209,7 @@ void cubic_b_spline(
       const xyze_pos_t &pos = bez_target;
     #endif
 
-    if (!planner.buffer_line(pos, scaled_fr_mm_s, active_extruder, step))
+    if (!TERN(HAS_CHORDAL_TOLERANCE, segmenter, planner).buffer_line(pos, scaled_fr_mm_s, active_extruder, step))
       break;
   }
 }
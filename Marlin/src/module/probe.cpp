@@ -88,6 +88,10 @@ Probe probe;
 
 xyz_pos_t Probe::offset; // Initialized by settings.load()
 
+#if ENABLED(FLYING_PROBE)
+  bool Probe::flying; // = false
+#endif
+
 #if HAS_PROBE_XY_OFFSET
   const xy_pos_t &Probe::offset_xy = Probe::offset;
 #endif
@@ -401,6 +405,8 @@ bool Probe::set_deployed(const bool deploy) {
     DEBUG_ECHOLNPAIR("deploy: ", deploy);
   }
 
+  TERN_(FLYING_PROBE, end_flying());
+
   if (endstops.z_probe_enabled == deploy) return false;
 
   // Make room for probe to deploy (or stow)
@@ -457,6 +463,19 @@ bool Probe::set_deployed(const bool deploy) {
   return false;
 }
 
+#if ENABLED(FLYING_PROBE)
+
+  /**
+   * @brief Lift a probe left at trigger height by a PROBE_PT_FLY probe
+   */
+  void Probe::end_flying() {
+    if (!flying) return;
+    flying = false;
+    do_z_raise(Z_CLEARANCE_BETWEEN_PROBES);
+  }
+
+#endif
+
 /**
  * @brief Used by run_z_probe to do a single Z probe move.
  *
@@ -740,7 +759,8 @@ float Probe::run_z_probe(const bool sanity_check/*=true*/) {
  * - Probe the bed, get the Z position
  * - Depending on the 'stow' flag
  *   - Stow the probe, or
- *   - Raise to the BETWEEN height
+ *   - Raise to the BETWEEN height, or
+ *   - Stay at trigger height to fly to the next point (FLYING_PROBE)
  * - Return the probed Z position
  */
 float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRaise raise_after/*=PROBE_PT_NONE*/, const uint8_t verbose_level/*=0*/, const bool probe_relative/*=true*/, const bool sanity_check/*=true*/) {
@@ -760,6 +780,10 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
     if (bltouch.triggered()) bltouch._reset();
   #endif
 
+  // Flying probes may only be flown on to the next PROBE_PT_FLY point
+  const bool fly = TERN0(FLYING_PROBE, flying && raise_after == PROBE_PT_FLY);
+  TERN_(FLYING_PROBE, if (!fly) end_flying());
+
   // On delta keep Z below clip height or do_blocking_move_to will abort
   xyz_pos_t npos = { rx, ry, _MIN(TERN(DELTA, delta_clip_start_height, current_position.z), current_position.z) };
   if (probe_relative) {                                     // The given position is in terms of the probe
@@ -771,11 +795,32 @@ float Probe::probe_at_point(const_float_t rx, const_float_t ry, const ProbePtRai
   }
   else if (!position_is_reachable(npos)) return NAN;        // The given position is in terms of the nozzle
 
-  // Move the probe to the starting XYZ
-  do_blocking_move_to(npos, feedRate_t(XY_PROBE_FEEDRATE_MM_S));
-
   float measured_z = NAN;
-  if (!deploy()) measured_z = run_z_probe(sanity_check) + offset.z;
+
+  #if ENABLED(FLYING_PROBE)
+    if (fly) {
+      // Queue the lift, the travel and the descent so they run without stopping.
+      // The probe is still deployed and the trigger ends the descent block.
+      current_position.z += FLYING_PROBE_CLEARANCE;
+      line_to_current_position(z_probe_fast_mm_s);
+      current_position.set(npos.x, npos.y);
+      line_to_current_position(feedRate_t(XY_PROBE_FEEDRATE_MM_S));
+      if (!probe_down_to_z(-offset.z + Z_PROBE_LOW_POINT, MMM_TO_MMS(Z_PROBE_FEEDRATE_SLOW)))
+        measured_z = current_position.z + offset.z;
+      else if (DEBUGGING(LEVELING))
+        DEBUG_ECHOLNPGM("FLY Probe fail! - No trigger.");
+    }
+    else
+  #endif
+  {
+    // Move the probe to the starting XYZ
+    do_blocking_move_to(npos, feedRate_t(XY_PROBE_FEEDRATE_MM_S));
+
+    if (!deploy()) measured_z = run_z_probe(sanity_check) + offset.z;
+  }
+
+  TERN_(FLYING_PROBE, flying = raise_after == PROBE_PT_FLY && !isnan(measured_z));
+
   if (!isnan(measured_z)) {
     const bool big_raise = raise_after == PROBE_PT_BIG_RAISE;
     if (big_raise || raise_after == PROBE_PT_RAISE)
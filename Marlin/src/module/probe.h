@@ -34,7 +34,8 @@
     PROBE_PT_NONE,      // No raise or stow after run_z_probe
     PROBE_PT_STOW,      // Do a complete stow after run_z_probe
     PROBE_PT_RAISE,     // Raise to "between" clearance after run_z_probe
-    PROBE_PT_BIG_RAISE  // Raise to big clearance after run_z_probe
+    PROBE_PT_BIG_RAISE, // Raise to big clearance after run_z_probe
+    PROBE_PT_FLY        // Stay at trigger height. The next PROBE_PT_FLY point is flown to.
   };
 #endif
 
@@ -257,6 +258,10 @@ public:
   #endif
 
 private:
+  #if ENABLED(FLYING_PROBE)
+    static bool flying;   // Left at trigger height by a PROBE_PT_FLY probe
+    static void end_flying();
+  #endif
   static bool probe_down_to_z(const_float_t z, const_feedRate_t fr_mm_s);
   static void do_z_raise(const float z_raise);
   static float run_z_probe(const bool sanity_check=true);
@@ -128,6 +128,10 @@
   #include "../feature/probe_temp_comp.h"
 #endif
 
+#if HAS_CHORDAL_TOLERANCE
+  #include "chordal.h"
+#endif
+
 #include "../feature/controllerfan.h"
 #if ENABLED(CONTROLLER_FAN_EDITABLE)
   void M710_report(const bool forReplay);
@@ -201,6 +205,14 @@ typedef struct SettingsDataStruct {
   xyze_float_t planner_max_jerk;                        // M205 XYZE  planner.max_jerk
   float planner_junction_deviation_mm;                  // M205 J     planner.junction_deviation_mm
 
+  #if HAS_CHORDAL_TOLERANCE
+    float chordal_tolerance;                            // M214 S     segmenter.tolerance
+  #endif
+
+  #if HAS_SHAPING
+    shaping_settings_t input_shaping[2];                // M593 X Y F D T  stepper.shaping
+  #endif
+
   xyz_pos_t home_offset;                                // M206 XYZ / M665 TPZ
 
   #if HAS_HOTEND_OFFSET
@@ -662,6 +674,22 @@ void MarlinSettings::postprocess() {
       EEPROM_WRITE(TERN(CLASSIC_JERK, dummyf, planner.junction_deviation_mm));
     }
 
+    //
+    // Chordal Tolerance
+    //
+    #if HAS_CHORDAL_TOLERANCE
+      _FIELD_TEST(chordal_tolerance);
+      EEPROM_WRITE(segmenter.tolerance);
+    #endif
+
+    //
+    // Input Shaping
+    //
+    #if HAS_SHAPING
+      _FIELD_TEST(input_shaping);
+      EEPROM_WRITE(stepper.shaping);
+    #endif
+
     //
     // Home Offset
     //
@@ -1545,6 +1573,26 @@ void MarlinSettings::postprocess() {
         EEPROM_READ(TERN(CLASSIC_JERK, dummyf, planner.junction_deviation_mm));
       }
 
+      //
+      // Chordal Tolerance
+      //
+      #if HAS_CHORDAL_TOLERANCE
+        _FIELD_TEST(chordal_tolerance);
+        EEPROM_READ(segmenter.tolerance);
+      #endif
+
+      //
+      // Input Shaping
+      //
+      #if HAS_SHAPING
+      {
+        shaping_settings_t input_shaping[2];
+        _FIELD_TEST(input_shaping);
+        EEPROM_READ(input_shaping);
+        if (!validating) LOOP_L_N(a, 2) stepper.set_shaping(AxisEnum(a), input_shaping[a]);
+      }
+      #endif
+
       //
       // Home Offset (M206 / M665)
       //
@@ -1853,6 +1901,9 @@ void MarlinSettings::postprocess() {
       {
         _FIELD_TEST(user_thermistor);
         EEPROM_READ(thermalManager.user_thermistor);
+        #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+          LOOP_L_N(i, USER_THERMISTORS) thermalManager.user_thermistor[i].pre_calc = true; // Rebuild the lookups
+        #endif
       }
       #endif
 
@@ -2470,7 +2521,7 @@ void MarlinSettings::postprocess() {
                                                           // or down a little bit without disrupting the mesh data
     }
 
-    #define MESH_STORE_SIZE sizeof(TERN(OPTIMIZED_MESH_STORAGE, mesh_store_t, ubl.z_values))
+    #define MESH_STORE_SIZE sizeof(TERN(OPTIMIZED_MESH_STORAGE, mesh_store_t, TERN(COMPRESSED_MESH_STORAGE, mesh_store_t, ubl.z_values)))
 
     uint16_t MarlinSettings::calc_num_meshes() {
       return (meshes_end - meshes_start_index()) / MESH_STORE_SIZE;
@@ -2498,17 +2549,27 @@ void MarlinSettings::postprocess() {
           int16_t z_mesh_store[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
           ubl.set_store_from_mesh(ubl.z_values, z_mesh_store);
           uint8_t * const src = (uint8_t*)&z_mesh_store;
+        #elif ENABLED(COMPRESSED_MESH_STORAGE)
+          mesh_store_t z_mesh_store;
+          ubl.set_store_from_mesh(ubl.z_values, z_mesh_store);
+          uint8_t * const src = (uint8_t*)&z_mesh_store;
+          const size_t store_size = MESH_STORE_HEADER_SIZE + z_mesh_store.size; // Only the used part of the slot
         #else
           uint8_t * const src = (uint8_t*)&ubl.z_values;
         #endif
 
         // Write crc to MAT along with other data, or just tack on to the beginning or end
         persistentStore.access_start();
-        const bool status = persistentStore.write_data(pos, src, MESH_STORE_SIZE, &crc);
+        const bool status = persistentStore.write_data(pos, src, TERN(COMPRESSED_MESH_STORAGE, store_size, MESH_STORE_SIZE), &crc);
         persistentStore.access_finish();
 
         if (status) SERIAL_ECHOLNPGM("?Unable to save mesh data.");
-        else        DEBUG_ECHOLNPAIR("Mesh saved in slot ", slot);
+        else {
+          DEBUG_ECHOLNPAIR("Mesh saved in slot ", slot);
+          #if ENABLED(COMPRESSED_MESH_STORAGE)
+            if (z_mesh_store.shift) SERIAL_ECHOLNPAIR("Mesh stored with ", 1UL << z_mesh_store.shift, "um resolution.");
+          #endif
+        }
 
       #else
 
@@ -2533,12 +2594,21 @@ void MarlinSettings::postprocess() {
         #if ENABLED(OPTIMIZED_MESH_STORAGE)
           int16_t z_mesh_store[GRID_MAX_POINTS_X][GRID_MAX_POINTS_Y];
           uint8_t * const dest = (uint8_t*)&z_mesh_store;
+        #elif ENABLED(COMPRESSED_MESH_STORAGE)
+          mesh_store_t z_mesh_store;
+          uint8_t * const dest = (uint8_t*)&z_mesh_store;
         #else
           uint8_t * const dest = into ? (uint8_t*)into : (uint8_t*)&ubl.z_values;
         #endif
 
         persistentStore.access_start();
-        const uint16_t status = persistentStore.read_data(pos, dest, MESH_STORE_SIZE, &crc);
+        #if ENABLED(COMPRESSED_MESH_STORAGE)
+          // Read the header, then only the used part of the slot. The CRC is checked on unpacking.
+          uint16_t status = persistentStore.read_data(pos, dest, MESH_STORE_HEADER_SIZE, &crc);
+          if (!status) status = z_mesh_store.size > MESH_STORE_BYTES || persistentStore.read_data(pos, z_mesh_store.data, z_mesh_store.size, &crc);
+        #else
+          const uint16_t status = persistentStore.read_data(pos, dest, MESH_STORE_SIZE, &crc);
+        #endif
         persistentStore.access_finish();
 
         #if ENABLED(OPTIMIZED_MESH_STORAGE)
@@ -2551,6 +2621,11 @@ void MarlinSettings::postprocess() {
             ubl.set_mesh_from_store(z_mesh_store, ubl.z_values);
         #endif
 
+        #if ENABLED(COMPRESSED_MESH_STORAGE)
+          // Leave the current mesh alone if the slot is empty or damaged
+          if (!status && !ubl.set_mesh_from_store(z_mesh_store, into ? *(bed_mesh_t*)into : ubl.z_values)) status = true;
+        #endif
+
         if (status) SERIAL_ECHOLNPGM("?Unable to load mesh data.");
         else        DEBUG_ECHOLNPAIR("Mesh loaded from slot ", slot);
 
@@ -2612,6 +2687,17 @@ void MarlinSettings::reset() {
     planner.junction_deviation_mm = float(JUNCTION_DEVIATION_MM);
   #endif
 
+  TERN_(HAS_CHORDAL_TOLERANCE, segmenter.reset());
+
+  #if HAS_SHAPING
+    #if ENABLED(INPUT_SHAPING_X)
+      stepper.set_shaping(X_AXIS, { SHAPING_FREQ_X, SHAPING_ZETA_X, ShaperType(SHAPING_TYPE_X) });
+    #endif
+    #if ENABLED(INPUT_SHAPING_Y)
+      stepper.set_shaping(Y_AXIS, { SHAPING_FREQ_Y, SHAPING_ZETA_Y, ShaperType(SHAPING_TYPE_Y) });
+    #endif
+  #endif
+
   #if HAS_SCARA_OFFSET
     scara_home_offset.reset();
   #elif HAS_HOME_OFFSET
@@ -3219,6 +3305,25 @@ void MarlinSettings::reset() {
       #endif
     );
 
+    #if HAS_CHORDAL_TOLERANCE
+      CONFIG_ECHO_HEADING("Arc and curve chordal tolerance:");
+      CONFIG_ECHO_START();
+      SERIAL_ECHOLNPAIR_F("  M214 S", LINEAR_UNIT(segmenter.tolerance), 3);
+    #endif
+
+    #if HAS_SHAPING
+      CONFIG_ECHO_HEADING("Input shaping:");
+      LOOP_L_N(a, 2) {
+        if (a == X_AXIS ? DISABLED(INPUT_SHAPING_X) : DISABLED(INPUT_SHAPING_Y)) continue;
+        const shaping_settings_t &is = stepper.shaping[a];
+        CONFIG_ECHO_START();
+        SERIAL_ECHOPAIR("  M593 ", AS_CHAR(a == X_AXIS ? 'X' : 'Y'));
+        SERIAL_ECHOPAIR_F(" F", is.frequency, 2);
+        SERIAL_ECHOPAIR_F(" D", is.zeta, 3);
+        SERIAL_ECHOLNPAIR(" T", int(is.type));
+      }
+    #endif
+
     #if HAS_M206_COMMAND
       CONFIG_ECHO_HEADING("Home offset:");
       CONFIG_ECHO_START();
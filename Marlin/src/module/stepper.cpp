@@ -200,7 +200,7 @@ uint32_t Stepper::advance_divisor = 0,
   constexpr uint8_t Stepper::stepper_extruder;
 #endif
 
-#if ENABLED(S_CURVE_ACCELERATION)
+#if ENABLED(HAS_BEZIER_S_CURVE)
   int32_t __attribute__((used)) Stepper::bezier_A __asm__("bezier_A");    // A coefficient in Bézier speed curve with alias for assembler
   int32_t __attribute__((used)) Stepper::bezier_B __asm__("bezier_B");    // B coefficient in Bézier speed curve with alias for assembler
   int32_t __attribute__((used)) Stepper::bezier_C __asm__("bezier_C");    // C coefficient in Bézier speed curve with alias for assembler
@@ -230,10 +230,50 @@ uint32_t Stepper::advance_divisor = 0,
   uint32_t Stepper::nextBabystepISR = BABYSTEP_NEVER;
 #endif
 
+#if HAS_SHAPING
+  shaping_settings_t Stepper::shaping[2];
+  Stepper::shaper_t Stepper::shaper[2] = { { 0, { shaping_unit } }, { 0, { shaping_unit } } }; // Not shaped until the settings are applied
+  Stepper::shaping_event_t Stepper::shaping_ring[SHAPING_BUFFER_SIZE];
+  volatile Stepper::shaping_index_t Stepper::shaping_head, // = 0
+                                    Stepper::shaping_tail; // = 0
+  uint32_t Stepper::shaping_time, // = 0
+           Stepper::shaping_min_delay = SHAPING_NEVER,
+           Stepper::nextShapingISR = SHAPING_NEVER;
+  bool Stepper::shaping_enabled = true;
+#endif
+
 #if ENABLED(DIRECT_STEPPING)
   page_step_state_t Stepper::page_step_state;
 #endif
 
+#if ENABLED(NATIVE_ARC_BLOCKS)
+  uint32_t Stepper::chord_events_left, // = 0
+           Stepper::arc_chords_left,
+           Stepper::arc_l_error, Stepper::arc_e_error;
+  float Stepper::arc_rvec_p, Stepper::arc_rvec_q;
+  int32_t Stepper::arc_steps_p, Stepper::arc_steps_q;
+#endif
+
+#if ENABLED(STEPPER_LEVELING)
+  uint32_t Stepper::level_divisor,
+           Stepper::level_events_left; // = 0
+  uint8_t Stepper::level_piece;
+  #define BRESENHAM_DIVISOR(AXIS) (_AXIS(AXIS) == Z_AXIS ? level_divisor : advance_divisor)
+#else
+  #define BRESENHAM_DIVISOR(AXIS) advance_divisor
+#endif
+
+#if ENABLED(STEP_SCHEDULE)
+  Stepper::step_event_t Stepper::schedule[STEP_SCHEDULE_SIZE];
+  volatile Stepper::schedule_index_t Stepper::schedule_head, // = 0
+                                     Stepper::schedule_tail; // = 0
+  Stepper::schedule_index_t Stepper::schedule_write; // = 0
+  uint8_t Stepper::schedule_direction_bits; // = 0
+  bool Stepper::schedule_in_block, Stepper::schedule_pulsed;
+  hal_timer_t Stepper::schedule_pulse_end;
+  uint32_t Stepper::schedule_underruns; // = 0
+#endif
+
 int32_t Stepper::ticks_nominal = -1;
 #if DISABLED(S_CURVE_ACCELERATION)
   uint32_t Stepper::acc_step_rate; // needed for deceleration start point
@@ -486,6 +526,13 @@ void Stepper::set_directions() {
     SET_STEP_DIR(Z); // C
   #endif
 
+  #if ENABLED(INPUT_SHAPING_X)
+    shaper[X_AXIS].reverse = motor_direction(X_AXIS);
+  #endif
+  #if ENABLED(INPUT_SHAPING_Y)
+    shaper[Y_AXIS].reverse = motor_direction(Y_AXIS);
+  #endif
+
   #if DISABLED(LIN_ADVANCE)
     #if ENABLED(MIXING_EXTRUDER)
        // Because this is valid for the whole block we don't know
@@ -534,7 +581,7 @@ void Stepper::set_directions() {
   DIR_WAIT_AFTER();
 }
 
-#if ENABLED(S_CURVE_ACCELERATION)
+#if ENABLED(HAS_BEZIER_S_CURVE)
   /**
    *  This uses a quintic (fifth-degree) Bézier polynomial for the velocity curve, giving
    *  a "linear pop" velocity curve; with pop being the sixth derivative of position:
@@ -1337,7 +1384,7 @@ void Stepper::set_directions() {
       #endif
     }
   #endif
-#endif // S_CURVE_ACCELERATION
+#endif // HAS_BEZIER_S_CURVE
 
 /**
  * Stepper Driver Interrupt
@@ -1359,6 +1406,27 @@ HAL_STEP_TIMER_ISR() {
   #define STEP_MULTIPLY(A,B) MultiU24X32toH16(A, B)
 #endif
 
+#if ENABLED(S_CURVE_JERK_LIMITED)
+  /**
+   * The rate change at time 't' into a constant-jerk ramp, from the polynomial of its phase:
+   *
+   *   t < jerk_time:                  J t^2 / 2
+   *   t < ramp_time - jerk_time:      J jerk_time^2 / 2 + A (t - jerk_time)
+   *   t < ramp_time:                  rate_change - J (ramp_time - t)^2 / 2
+   *
+   * The planner scales jerk_rate so that two STEP_MULTIPLY by the time give J t^2 / 2,
+   * and acceleration_rate so that one gives A t, all in steps/s.
+   */
+  uint32_t Stepper::_eval_jerk_ramp(const uint32_t t, const uint32_t ramp_time, const uint32_t jerk_time, const uint32_t rate_change) {
+    if (t >= ramp_time) return rate_change;
+    const uint32_t jerk_rate = current_block->jerk_rate;
+    if (t < jerk_time) return STEP_MULTIPLY(t, STEP_MULTIPLY(t, jerk_rate));
+    const uint32_t left = ramp_time - t;
+    if (left < jerk_time) return rate_change - _MIN(rate_change, STEP_MULTIPLY(left, STEP_MULTIPLY(left, jerk_rate)));
+    return _MIN(rate_change, STEP_MULTIPLY(jerk_time, STEP_MULTIPLY(jerk_time, jerk_rate)) + STEP_MULTIPLY(t - jerk_time, current_block->acceleration_rate));
+  }
+#endif
+
 void Stepper::isr() {
 
   static uint32_t nextMainISR = 0;  // Interval until the next main Stepper Pulse phase (0 = Now)
@@ -1380,18 +1448,28 @@ void Stepper::isr() {
   // Limit the amount of iterations
   uint8_t max_loops = 10;
 
+  TERN_(STEP_SCHEDULE, schedule_pulsed = false);
+
   // We need this variable here to be able to use it in the following loop
   hal_timer_t min_ticks;
   do {
     // Enable ISRs to reduce USART processing latency
     ENABLE_ISRS();
 
-    if (!nextMainISR) pulse_phase_isr();                            // 0 = Do coordinated axes Stepper pulses
+    #if ENABLED(STEP_SCHEDULE)
+      if (!nextMainISR) nextMainISR = schedule_phase_isr();         // 0 = Run the due step events
+    #else
+      if (!nextMainISR) pulse_phase_isr();                          // 0 = Do coordinated axes Stepper pulses
+    #endif
 
     #if ENABLED(LIN_ADVANCE)
       if (!nextAdvanceISR) nextAdvanceISR = advance_isr();          // 0 = Do Linear Advance E Stepper pulses
     #endif
 
+    #if HAS_SHAPING
+      if (!nextShapingISR) nextShapingISR = shaping_isr();          // 0 = Do the due echoes of shaped axes
+    #endif
+
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       const bool is_babystep = (nextBabystepISR == 0);              // 0 = Do Babystepping (XY)Z pulses
       if (is_babystep) nextBabystepISR = babystepping_isr();
@@ -1399,7 +1477,9 @@ void Stepper::isr() {
 
     // ^== Time critical. NOTHING besides pulse generation should be above here!!!
 
-    if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    #if DISABLED(STEP_SCHEDULE)
+      if (!nextMainISR) nextMainISR = block_phase_isr();  // Manage acc/deceleration, get next block
+    #endif
 
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (is_babystep)                                  // Avoid ANY stepping too soon after baby-stepping
@@ -1415,6 +1495,9 @@ void Stepper::isr() {
       #if ENABLED(LIN_ADVANCE)
         , nextAdvanceISR                                // Come back early for Linear Advance?
       #endif
+      #if HAS_SHAPING
+        , nextShapingISR                                // Come back early for Input Shaping?
+      #endif
       #if ENABLED(INTEGRATED_BABYSTEPPING)
         , nextBabystepISR                               // Come back early for Babystepping?
       #endif
@@ -1434,6 +1517,11 @@ void Stepper::isr() {
       if (nextAdvanceISR != LA_ADV_NEVER) nextAdvanceISR -= interval;
     #endif
 
+    #if HAS_SHAPING
+      if (nextShapingISR != SHAPING_NEVER) nextShapingISR -= interval;
+      shaping_time += interval;
+    #endif
+
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       if (nextBabystepISR != BABYSTEP_NEVER) nextBabystepISR -= interval;
     #endif
@@ -1538,6 +1626,9 @@ void Stepper::pulse_phase_isr() {
   // Skipping step processing causes motion to freeze
   if (TERN0(HAS_FREEZE_PIN, frozen)) return;
 
+  // Wait for the echoes of shaped axes to free up the ring
+  if (TERN0(HAS_SHAPING, shaping_ring_t::next(shaping_head) == shaping_tail)) return;
+
   // Count of pending loops and events for this iteration
   const uint32_t pending_events = step_event_count - step_events_completed;
   uint8_t events_to_do = _MIN(pending_events, steps_per_isr);
@@ -1562,7 +1653,7 @@ void Stepper::pulse_phase_isr() {
       step_needed[_AXIS(AXIS)] = (delta_error[_AXIS(AXIS)] >= 0); \
       if (step_needed[_AXIS(AXIS)]) { \
         count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
-        delta_error[_AXIS(AXIS)] -= advance_divisor; \
+        delta_error[_AXIS(AXIS)] -= BRESENHAM_DIVISOR(AXIS); \
       } \
     }while(0)
 
@@ -1718,6 +1809,35 @@ void Stepper::pulse_phase_isr() {
       #endif
     }
 
+    #if HAS_SHAPING
+      // Shaped axes take the first impulse of each step now, and keep the step for its echoes
+      #define SHAPING_PREP(AXIS) do{ \
+        shaper_t &s = shaper[_AXIS(AXIS)]; \
+        if (s.echoes && step_needed[_AXIS(AXIS)]) { \
+          const int8_t dir = count_direction[_AXIS(AXIS)]; \
+          s.steps += dir; \
+          s.error += s.amplitude[0] * dir; \
+          step_needed[_AXIS(AXIS)] = ABS(s.error) > shaping_unit / 2; \
+          if (step_needed[_AXIS(AXIS)]) { \
+            s.error -= dir * shaping_unit; \
+            if (s.reverse != (dir < 0)) { \
+              s.reverse = !s.reverse; \
+              DIR_WAIT_BEFORE(); \
+              AXIS##_APPLY_DIR(s.reverse ? INVERT_##AXIS##_DIR : !INVERT_##AXIS##_DIR, false); \
+              DIR_WAIT_AFTER(); \
+            } \
+          } \
+        } \
+      }while(0)
+
+      #if ENABLED(INPUT_SHAPING_X)
+        SHAPING_PREP(X);
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        SHAPING_PREP(Y);
+      #endif
+    #endif
+
     #if ISR_MULTI_STEPS
       if (firstStep)
         firstStep = false;
@@ -1780,9 +1900,137 @@ void Stepper::pulse_phase_isr() {
       if (events_to_do) START_LOW_PULSE();
     #endif
 
+    #if ENABLED(NATIVE_ARC_BLOCKS)
+      // At the end of a chord turn to the next one
+      if (chord_events_left && !--chord_events_left) next_arc_chord();
+    #endif
+
+    #if ENABLED(STEPPER_LEVELING)
+      // At the end of a piece follow the next one
+      if (level_events_left && !--level_events_left) next_level_piece();
+    #endif
+
   } while (--events_to_do);
+
+  #if HAS_SHAPING
+    // Keep the steps of the shaped axes until every echo has played them
+    if (shaper[X_AXIS].steps || shaper[Y_AXIS].steps) {
+      shaping_event_t &event = shaping_ring[shaping_head];
+      event.time = shaping_time;
+      LOOP_L_N(a, 2) { event.steps[a] = shaper[a].steps; shaper[a].steps = 0; }
+      shaping_head = shaping_ring_t::next(shaping_head);
+      NOMORE(nextShapingISR, shaping_min_delay);
+    }
+  #endif
 }
 
+#if ENABLED(NATIVE_ARC_BLOCKS)
+
+  /**
+   * Set up the Bresenham tracer for the next chord of an arc block.
+   * The chord ends are found by rotating the radius vector, and the last
+   * chord ends exactly on the end point of the block. The linear axis and
+   * E are spread evenly over the chords.
+   */
+  void Stepper::next_arc_chord() {
+    if (!arc_chords_left) return;
+
+    const block_arc_t &arc = current_block->arc;
+
+    int32_t to_p, to_q;
+    if (--arc_chords_left) {
+      // Rotate the radius vector, and correct its length to first order
+      const float rp = arc_rvec_p * arc.cos_t - arc_rvec_q * arc.sin_t,
+                  rq = arc_rvec_p * arc.sin_t + arc_rvec_q * arc.cos_t,
+                  k = 1.5f - 0.5f * (sq(rp) + sq(rq)) * arc.inv_radius_sqr;
+      arc_rvec_p = rp * k;
+      arc_rvec_q = rq * k;
+      to_p = LROUND((arc_rvec_p - arc.rvec_p) * arc.steps_per_mm_p);
+      to_q = LROUND((arc_rvec_q - arc.rvec_q) * arc.steps_per_mm_q);
+    }
+    else {
+      to_p = arc.delta_p;
+      to_q = arc.delta_q;
+    }
+
+    const int32_t dp = to_p - arc_steps_p, dq = to_q - arc_steps_q;
+    arc_steps_p = to_p;
+    arc_steps_q = to_q;
+
+    // The planner made every chord long enough for the steps of all axes
+    const uint32_t events = arc.chord_events << oversampling_factor;
+    chord_events_left = events;
+    delta_error = -int32_t(events);
+    advance_divisor = events << 1;
+    TERN_(STEPPER_LEVELING, level_divisor = advance_divisor);
+    advance_dividend[arc.axis_p] = uint32_t(ABS(dp)) << 1;
+    advance_dividend[arc.axis_q] = uint32_t(ABS(dq)) << 1;
+
+    arc_l_error += current_block->steps[arc.axis_l];
+    const uint32_t dl = arc_l_error / arc.chords;
+    arc_l_error -= dl * arc.chords;
+    advance_dividend[arc.axis_l] = dl << 1;
+
+    #if HAS_EXTRUDERS
+      arc_e_error += current_block->steps.e;
+      const uint32_t de = arc_e_error / arc.chords;
+      arc_e_error -= de * arc.chords;
+      advance_dividend.e = de << 1;
+    #endif
+
+    // Only the axes of the plane turn around, and only when they move
+    uint8_t dm = current_block->direction_bits;
+    if (dp) SET_BIT_TO(dm, arc.axis_p, dp < 0);
+    if (dq) SET_BIT_TO(dm, arc.axis_q, dq < 0);
+    current_block->direction_bits = dm;
+    #if ENABLED(STEP_SCHEDULE)
+      if (dm != schedule_direction_bits) {
+        schedule_direction_bits = dm;
+        schedule_event(SE_DIRECTION, dm);
+      }
+    #else
+      if (dm != last_direction_bits) set_directions(dm);
+    #endif
+  }
+
+#endif // NATIVE_ARC_BLOCKS
+
+#if ENABLED(STEPPER_LEVELING)
+
+  /**
+   * Set up the Z Bresenham for the next piece of a leveled block.
+   * Z has its own divisor so the other axes carry on undisturbed.
+   */
+  void Stepper::next_level_piece() {
+    const block_level_t &level = current_block->level;
+    if (level_piece >= level.pieces) return;
+
+    const uint8_t i = level_piece++;
+    const uint32_t events = (level.events[i] - (i ? level.events[i - 1] : 0)) << oversampling_factor;
+    const int32_t dz = level.z[i] - (i ? level.z[i - 1] : 0);
+
+    level_events_left = events;
+    delta_error.z = -int32_t(events);
+    level_divisor = events << 1;
+    advance_dividend.z = uint32_t(ABS(dz)) << 1;
+
+    // Z turns around wherever the bed does
+    if (!dz) return;
+    uint8_t dm = current_block->direction_bits;
+    SET_BIT_TO(dm, Z_AXIS, dz < 0);
+    current_block->direction_bits = dm;
+    #if ENABLED(STEP_SCHEDULE)
+      if (dm != schedule_direction_bits) {
+        schedule_direction_bits = dm;
+        schedule_event(SE_DIRECTION, dm);
+      }
+    #else
+      if (dm != last_direction_bits) set_directions(dm);
+    #endif
+  }
+
+#endif // STEPPER_LEVELING
+
 // This is the last half of the stepper interrupt: This one processes and
 // properly schedules blocks from the planner. This is executed after creating
 // the step pulses, so it is not time critical, as pulses are already done.
@@ -1822,7 +2070,11 @@ uint32_t Stepper::block_phase_isr() {
       // Are we in acceleration phase ?
       if (step_events_completed <= accelerate_until) { // Calculate new timer value
 
-        #if ENABLED(S_CURVE_ACCELERATION)
+        #if ENABLED(S_CURVE_JERK_LIMITED)
+          // Get the next speed to use from the constant-jerk ramp
+          const uint32_t acc_step_rate = current_block->initial_rate + _eval_jerk_ramp(acceleration_time,
+            current_block->acceleration_time, current_block->acceleration_jerk_time, current_block->cruise_rate - current_block->initial_rate);
+        #elif ENABLED(S_CURVE_ACCELERATION)
           // Get the next speed to use (Jerk limited!)
           uint32_t acc_step_rate = acceleration_time < current_block->acceleration_time
                                    ? _eval_bezier_curve(acceleration_time)
@@ -1879,7 +2131,11 @@ uint32_t Stepper::block_phase_isr() {
       else if (step_events_completed > decelerate_after) {
         uint32_t step_rate;
 
-        #if ENABLED(S_CURVE_ACCELERATION)
+        #if ENABLED(S_CURVE_JERK_LIMITED)
+          // Calculate the next speed to use from the constant-jerk ramp
+          step_rate = current_block->cruise_rate - _eval_jerk_ramp(deceleration_time,
+            current_block->deceleration_time, current_block->deceleration_jerk_time, current_block->cruise_rate - current_block->final_rate);
+        #elif ENABLED(S_CURVE_ACCELERATION)
           // If this is the 1st time we process the 2nd half of the trapezoid...
           if (!bezier_2nd_half) {
             // Initialize the Bézier speed curve
@@ -1998,6 +2254,14 @@ uint32_t Stepper::block_phase_isr() {
       // Sync block? Sync the stepper counts or fan speeds and return
       while (current_block->flag & BLOCK_MASK_SYNC) {
 
+        #if ENABLED(STEP_SCHEDULE)
+          // Let the scheduled steps run out first. Come back for this block later.
+          if (!schedule_drained()) {
+            current_block = nullptr;
+            return interval;
+          }
+        #endif
+
         #if ENABLED(LASER_SYNCHRONOUS_M106_M107)
           const bool is_sync_fans = TEST(current_block->flag, BLOCK_BIT_SYNC_FANS);
           if (is_sync_fans) planner.sync_fan_speeds(current_block->fan_speed);
@@ -2112,7 +2376,9 @@ uint32_t Stepper::block_phase_isr() {
       //if (current_block->steps.a) SBI(axis_bits, X_HEAD);
       //if (current_block->steps.b) SBI(axis_bits, Y_HEAD);
       //if (current_block->steps.c) SBI(axis_bits, Z_HEAD);
-      axis_did_move = axis_bits;
+      #if DISABLED(STEP_SCHEDULE)
+        axis_did_move = axis_bits;
+      #endif
 
       // No acceleration / deceleration time elapsed so far
       acceleration_time = deceleration_time = 0;
@@ -2148,6 +2414,29 @@ uint32_t Stepper::block_phase_isr() {
       accelerate_until = current_block->accelerate_until << oversampling;
       decelerate_after = current_block->decelerate_after << oversampling;
 
+      #if ENABLED(NATIVE_ARC_BLOCKS)
+        // Arcs are traced chord by chord, starting with the first
+        chord_events_left = 0;
+        if (TEST(current_block->flag, BLOCK_BIT_IS_ARC)) {
+          arc_chords_left = current_block->arc.chords;
+          arc_rvec_p = current_block->arc.rvec_p;
+          arc_rvec_q = current_block->arc.rvec_q;
+          arc_steps_p = arc_steps_q = 0;
+          arc_l_error = arc_e_error = 0;
+          next_arc_chord();
+        }
+      #endif
+
+      #if ENABLED(STEPPER_LEVELING)
+        // Leveled blocks move Z piece by piece, starting with the first
+        level_divisor = advance_divisor;
+        level_events_left = 0;
+        if (current_block->level.pieces) {
+          level_piece = 0;
+          next_level_piece();
+        }
+      #endif
+
       TERN_(MIXING_EXTRUDER, mixer.stepper_setup(current_block->b_color))
 
       TERN_(HAS_MULTI_EXTRUDER, stepper_extruder = current_block->extruder);
@@ -2170,12 +2459,17 @@ uint32_t Stepper::block_phase_isr() {
 
       if ( ENABLED(HAS_L64XX)       // Always set direction for L64xx (Also enables the chips)
         || ENABLED(DUAL_X_CARRIAGE) // TODO: Find out why this fixes "jittery" small circles
-        || current_block->direction_bits != last_direction_bits
+        || current_block->direction_bits != TERN(STEP_SCHEDULE, schedule_direction_bits, last_direction_bits)
         || TERN(MIXING_EXTRUDER, false, stepper_extruder != last_moved_extruder)
       ) {
         TERN_(HAS_MULTI_EXTRUDER, last_moved_extruder = stepper_extruder);
         TERN_(HAS_L64XX, L64XX_OK_to_power_up = true);
-        set_directions(current_block->direction_bits);
+        #if ENABLED(STEP_SCHEDULE)
+          schedule_direction_bits = current_block->direction_bits;
+          schedule_event(SE_DIRECTION, schedule_direction_bits);
+        #else
+          set_directions(current_block->direction_bits);
+        #endif
       }
 
       #if ENABLED(LASER_POWER_INLINE)
@@ -2216,7 +2510,11 @@ uint32_t Stepper::block_phase_isr() {
       // done against the endstop. So, check the limits here: If the movement
       // is against the limits, the block will be marked as to be killed, and
       // on the next call to this ISR, will be discarded.
-      endstops.update();
+      #if ENABLED(STEP_SCHEDULE)
+        schedule_event(SE_BLOCK_START, axis_bits);  // The Stepper ISR sets axis_did_move and checks the endstops
+      #else
+        endstops.update();
+      #endif
 
       #if ENABLED(Z_LATE_ENABLE)
         // If delayed Z enable, enable it now. This option will severely interfere with
@@ -2228,12 +2526,12 @@ uint32_t Stepper::block_phase_isr() {
       // Mark the time_nominal as not calculated yet
       ticks_nominal = -1;
 
-      #if ENABLED(S_CURVE_ACCELERATION)
+      #if ENABLED(HAS_BEZIER_S_CURVE)
         // Initialize the Bézier speed curve
         _calc_bezier_curve_coeffs(current_block->initial_rate, current_block->cruise_rate, current_block->acceleration_time_inverse);
         // We haven't started the 2nd half of the trapezoid
         bezier_2nd_half = false;
-      #else
+      #elif DISABLED(S_CURVE_ACCELERATION)
         // Set as deceleration point the initial rate of the block
         acc_step_rate = current_block->initial_rate;
       #endif
@@ -2262,6 +2560,203 @@ uint32_t Stepper::block_phase_isr() {
   return interval;
 }
 
+#if ENABLED(STEP_SCHEDULE)
+
+  // A SW memory barrier, so events are written before their index is published, and read after
+  #define schedule_barrier() asm volatile("": : :"memory")
+
+  /**
+   * Trace planner blocks into the step schedule, as far as it has room.
+   *
+   * Each pass is one pulse phase plus one block phase of the classic Stepper ISR:
+   * Bresenham picks the axes for the next steps_per_isr steps, then block_phase_isr()
+   * gives the interval to the following pass. The steps are spread evenly over that
+   * interval, and the Stepper ISR only sees them once the whole pass is written.
+   */
+  void Stepper::fill_schedule() {
+    static bool filling; // = false
+
+    // Never preempt itself, or a planner critical section (which suspends the Stepper ISR)
+    if (filling || !is_awake()) return;
+    filling = true;
+
+    if (abort_current_block) {
+      // The Stepper ISR drops the scheduled events. Then drop the block.
+      if (schedule_drained()) {
+        if (current_block) discard_current_block();
+        schedule_barrier();
+        schedule_head = schedule_write;
+        abort_current_block = false;
+      }
+    }
+    else {
+      // Leave room for a full pass, plus the events of a block change
+      while (schedule_ring_t::distance(schedule_tail, schedule_write) < STEP_SCHEDULE_SIZE - 4 - steps_per_isr) {
+        const schedule_index_t first = schedule_write;
+        uint8_t steps = 0;
+
+        if (current_block) {
+          steps = _MIN(step_event_count - step_events_completed, steps_per_isr);
+          step_events_completed += steps;
+
+          #define SCHEDULE_PREP(AXIS) do{ \
+            delta_error[_AXIS(AXIS)] += advance_dividend[_AXIS(AXIS)]; \
+            if (delta_error[_AXIS(AXIS)] >= 0) { \
+              delta_error[_AXIS(AXIS)] -= BRESENHAM_DIVISOR(AXIS); \
+              SBI(step_bits, _AXIS(AXIS)); \
+            } \
+          }while(0)
+
+          for (uint8_t i = steps; i--;) {
+            uint8_t step_bits = 0;
+            #if HAS_X_STEP
+              SCHEDULE_PREP(X);
+            #endif
+            #if HAS_Y_STEP
+              SCHEDULE_PREP(Y);
+            #endif
+            #if HAS_Z_STEP
+              SCHEDULE_PREP(Z);
+            #endif
+            #if HAS_E0_STEP
+              SCHEDULE_PREP(E);
+            #endif
+            schedule_event(SE_STEP, step_bits);
+            #if ENABLED(NATIVE_ARC_BLOCKS)
+              if (chord_events_left && !--chord_events_left) next_arc_chord();
+            #endif
+            #if ENABLED(STEPPER_LEVELING)
+              if (level_events_left && !--level_events_left) next_level_piece();
+            #endif
+          }
+        }
+
+        // Finish or start blocks, and get the interval to the next pass
+        const uint32_t interval = block_phase_isr();
+
+        if (schedule_write == first) break; // Nothing more to do for now
+
+        const uint32_t step_ticks = steps ? interval / steps : 0;
+        for (schedule_index_t i = first; i != schedule_write; i = schedule_ring_t::next(i))
+          if (schedule[i].type == SE_STEP) schedule[i].ticks = step_ticks;
+        schedule[schedule_ring_t::prev(schedule_write)].ticks += interval - step_ticks * steps;
+
+        schedule_barrier();
+        schedule_head = schedule_write;
+      }
+    }
+
+    filling = false;
+  }
+
+  /**
+   * Run step events up to the next one that has a delay.
+   * While a quick stop is pending, drop everything except the directions.
+   */
+  uint32_t Stepper::schedule_phase_isr() {
+
+    // Skipping the events causes motion to freeze
+    if (TERN0(HAS_FREEZE_PIN, frozen)) return (STEPPER_TIMER_RATE) / 1000UL;
+
+    const bool dropping = abort_current_block;
+
+    while (schedule_tail != schedule_head) {
+      schedule_barrier();
+      const step_event_t &event = schedule[schedule_tail];
+
+      switch (event.type) {
+        case SE_STEP: {
+          if (dropping || !event.bits) break;
+
+          #define SCHEDULE_PULSE_START(AXIS) do{ \
+            if (TEST(event.bits, _AXIS(AXIS))) { \
+              count_position[_AXIS(AXIS)] += count_direction[_AXIS(AXIS)]; \
+              AXIS##_APPLY_STEP(!INVERT_##AXIS##_STEP_PIN, 0); \
+            } \
+          }while(0)
+
+          #define SCHEDULE_PULSE_STOP(AXIS) do{ \
+            if (TEST(event.bits, _AXIS(AXIS))) AXIS##_APPLY_STEP(INVERT_##AXIS##_STEP_PIN, 0); \
+          }while(0)
+
+          #if ISR_MULTI_STEPS
+            // Keep the pulses of a burst apart
+            USING_TIMED_PULSE();
+            if (schedule_pulsed) {
+              start_pulse_count = schedule_pulse_end;
+              AWAIT_LOW_PULSE();
+            }
+          #endif
+
+          #if HAS_X_STEP
+            SCHEDULE_PULSE_START(X);
+          #endif
+          #if HAS_Y_STEP
+            SCHEDULE_PULSE_START(Y);
+          #endif
+          #if HAS_Z_STEP
+            SCHEDULE_PULSE_START(Z);
+          #endif
+          #if HAS_E0_STEP
+            SCHEDULE_PULSE_START(E);
+          #endif
+
+          #if ISR_MULTI_STEPS
+            START_HIGH_PULSE();
+            AWAIT_HIGH_PULSE();
+          #endif
+
+          #if HAS_X_STEP
+            SCHEDULE_PULSE_STOP(X);
+          #endif
+          #if HAS_Y_STEP
+            SCHEDULE_PULSE_STOP(Y);
+          #endif
+          #if HAS_Z_STEP
+            SCHEDULE_PULSE_STOP(Z);
+          #endif
+          #if HAS_E0_STEP
+            SCHEDULE_PULSE_STOP(E);
+          #endif
+
+          #if ISR_MULTI_STEPS
+            schedule_pulse_end = HAL_timer_get_count(PULSE_TIMER_NUM);
+            schedule_pulsed = true;
+          #endif
+        } break;
+
+        case SE_DIRECTION: set_directions(event.bits); break;
+
+        case SE_BLOCK_START:
+          schedule_in_block = true;
+          axis_did_move = event.bits;
+          if (!dropping) endstops.update(); // A move against a triggered endstop is aborted right away
+          break;
+
+        case SE_BLOCK_END:
+          schedule_in_block = false;
+          axis_did_move = 0;
+          planner.stepped_block_count++;
+          break;
+      }
+
+      const hal_timer_t ticks = event.ticks;
+      schedule_tail = schedule_ring_t::next(schedule_tail);
+      if (ticks && !dropping) return ticks;
+    }
+
+    // Ran dry in the middle of a block? Check back soon.
+    if (schedule_in_block && !dropping) {
+      schedule_underruns++;
+      return (STEPPER_TIMER_RATE) / 20000UL;
+    }
+
+    // Otherwise wait 1ms for the next block, like block_phase_isr()
+    return (STEPPER_TIMER_RATE) / 1000UL;
+  }
+
+#endif // STEP_SCHEDULE
+
 #if ENABLED(LIN_ADVANCE)
 
   // Timer interrupt for E. LA_steps is set in the main routine
@@ -2368,6 +2863,189 @@ uint32_t Stepper::block_phase_isr() {
 
 #endif // LIN_ADVANCE
 
+#if HAS_SHAPING
+
+  /**
+   * Input Shaping convolves the steps of X and Y with the impulses of a
+   * shaper. The pulse phase adds the first impulse of each step to the
+   * axis' shaped position, and this phase adds the delayed impulses (the
+   * echoes) from the ring of past steps. The motor follows the shaped
+   * position, rounded to whole steps.
+   */
+  uint32_t Stepper::shaping_isr() {
+    const shaping_index_t head = shaping_head;
+
+    // Add the due echoes to the shaped positions
+    LOOP_L_N(a, 2) {
+      shaper_t &s = shaper[a];
+      LOOP_L_N(e, s.echoes) {
+        shaping_index_t i = s.echo_index[e];
+        while (i != head && int32_t(shaping_time - shaping_ring[i].time - s.delay[e]) >= 0) {
+          s.error += s.amplitude[e + 1] * shaping_ring[i].steps[a];
+          i = shaping_ring_t::next(i);
+        }
+        s.echo_index[e] = i;
+      }
+    }
+
+    // Step the motors until they are within half a step of the shaped positions
+    #define SHAPING_ECHO_PREP(AXIS) do{ \
+      shaper_t &s = shaper[_AXIS(AXIS)]; \
+      step_needed[_AXIS(AXIS)] = ABS(s.error) > shaping_unit / 2; \
+      if (step_needed[_AXIS(AXIS)]) { \
+        const bool rev = s.error < 0; \
+        s.error += rev ? shaping_unit : -shaping_unit; \
+        if (s.reverse != rev) { \
+          s.reverse = rev; \
+          DIR_WAIT_BEFORE(); \
+          AXIS##_APPLY_DIR(rev ? INVERT_##AXIS##_DIR : !INVERT_##AXIS##_DIR, false); \
+          DIR_WAIT_AFTER(); \
+        } \
+      } \
+    }while(0)
+
+    #if ISR_PULSE_CONTROL
+      USING_TIMED_PULSE();
+      START_LOW_PULSE();    // The pulse phase may have just stepped the same motors
+    #endif
+
+    for (;;) {
+      xy_bool_t step_needed{0};
+      #if ENABLED(INPUT_SHAPING_X)
+        SHAPING_ECHO_PREP(X);
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        SHAPING_ECHO_PREP(Y);
+      #endif
+      if (!step_needed.x && !step_needed.y) break;
+
+      #if ISR_PULSE_CONTROL
+        AWAIT_LOW_PULSE();
+      #endif
+
+      #if ENABLED(INPUT_SHAPING_X)
+        if (step_needed.x) X_APPLY_STEP(!INVERT_X_STEP_PIN, 0);
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        if (step_needed.y) Y_APPLY_STEP(!INVERT_Y_STEP_PIN, 0);
+      #endif
+
+      #if ISR_PULSE_CONTROL
+        START_HIGH_PULSE();
+        AWAIT_HIGH_PULSE();
+      #endif
+
+      #if ENABLED(INPUT_SHAPING_X)
+        if (step_needed.x) X_APPLY_STEP(INVERT_X_STEP_PIN, 0);
+      #endif
+      #if ENABLED(INPUT_SHAPING_Y)
+        if (step_needed.y) Y_APPLY_STEP(INVERT_Y_STEP_PIN, 0);
+      #endif
+
+      #if ISR_PULSE_CONTROL
+        START_LOW_PULSE();
+      #endif
+    }
+
+    // Free the events every echo has played, and find the next due echo
+    uint32_t interval = SHAPING_NEVER;
+    shaping_index_t tail = head;
+    LOOP_L_N(a, 2) {
+      const shaper_t &s = shaper[a];
+      LOOP_L_N(e, s.echoes) {
+        const shaping_index_t i = s.echo_index[e];
+        if (i == head) continue;
+        NOMORE(interval, shaping_ring[i].time + s.delay[e] - shaping_time);
+        if (shaping_ring_t::distance(shaping_tail, i) < shaping_ring_t::distance(shaping_tail, tail)) tail = i;
+      }
+    }
+    shaping_tail = tail;
+
+    return interval;
+  }
+
+  void Stepper::set_shaping(const AxisEnum axis, const shaping_settings_t &settings) {
+    shaping[axis] = settings;
+    update_shaping();
+  }
+
+  void Stepper::set_shaping_enabled(const bool enable) {
+    shaping_enabled = enable;
+    update_shaping();
+  }
+
+  /**
+   * Work out the impulses of each shaper from its settings, using the
+   * damped period of the resonance. The echoes of the old shapers are
+   * played out first, so the motors end up on the counted position.
+   */
+  void Stepper::update_shaping() {
+    constexpr bool shapeable[2] = { ENABLED(INPUT_SHAPING_X), ENABLED(INPUT_SHAPING_Y) };
+
+    shaper_t fresh[2] = {};
+    LOOP_L_N(a, 2) {
+      const shaping_settings_t &set = shaping[a];
+      shaper_t &s = fresh[a];
+      float amp[max_echoes + 1] = { 1 }, time[max_echoes + 1] = { 0 };
+      if (shapeable[a] && shaping_enabled && set.frequency > 0) {
+        const float df = SQRT(1.0f - sq(set.zeta)),
+                    K = expf(-set.zeta * float(M_PI) / df),
+                    td = 1.0f / (set.frequency * df);
+        time[1] = td * 0.5f;
+        time[2] = td;
+        switch (set.type) {
+          case SHAPER_ZV:
+            s.echoes = 1;
+            amp[1] = K;
+            break;
+          case SHAPER_ZVD:
+            s.echoes = 2;
+            amp[1] = 2 * K;
+            amp[2] = sq(K);
+            break;
+          case SHAPER_EI: {
+            constexpr float v = 0.05f;  // Vibration tolerance
+            s.echoes = 2;
+            amp[0] = 0.25f * (1 + v);
+            amp[1] = 0.5f * (1 - v) * K;
+            amp[2] = amp[0] * sq(K);
+          } break;
+        }
+      }
+
+      // Round the running total, so the impulses always add up to one step
+      float sum = 0;
+      LOOP_LE_N(i, s.echoes) sum += amp[i];
+      float total = 0;
+      int16_t given = 0;
+      LOOP_LE_N(i, s.echoes) {
+        total += amp[i];
+        const int16_t upto = LROUND(total / sum * shaping_unit);
+        s.amplitude[i] = upto - given;
+        given = upto;
+        if (i) s.delay[i - 1] = LROUND(time[i] * (STEPPER_TIMER_RATE));
+      }
+    }
+
+    planner.synchronize();
+
+    const bool was_on = suspend();
+    shaping_min_delay = SHAPING_NEVER;
+    LOOP_L_N(a, 2) {
+      shaper_t &s = shaper[a];
+      s.echoes = fresh[a].echoes;
+      COPY(s.amplitude, fresh[a].amplitude);
+      COPY(s.delay, fresh[a].delay);
+      LOOP_L_N(e, s.echoes) {
+        s.echo_index[e] = shaping_head;
+        NOMORE(shaping_min_delay, s.delay[e]);
+      }
+    }
+    if (was_on) wake_up();
+  }
+
+#endif // HAS_SHAPING
+
 #if ENABLED(INTEGRATED_BABYSTEPPING)
 
   // Timer interrupt for baby-stepping
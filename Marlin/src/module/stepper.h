@@ -234,6 +234,17 @@
 // Perhaps DISABLE_MULTI_STEPPING should be required with ADAPTIVE_STEP_SMOOTHING.
 #define MIN_STEP_ISR_FREQUENCY (MAX_STEP_ISR_FREQUENCY_1X / 2)
 
+#if HAS_SHAPING
+  // Input shapers, as set with M593 T
+  enum ShaperType : uint8_t { SHAPER_ZV, SHAPER_ZVD, SHAPER_EI };
+
+  typedef struct {
+    float frequency;        // (Hz) Resonant frequency of the axis. 0 = Not shaped.
+    float zeta;             // Damping ratio
+    ShaperType type;
+  } shaping_settings_t;
+#endif
+
 //
 // Stepper class definition
 //
@@ -270,6 +281,10 @@ class Stepper {
       static bool frozen;                   // Set this flag to instantly freeze motion
     #endif
 
+    #if HAS_SHAPING
+      static shaping_settings_t shaping[2]; // M593 settings of X and Y. Apply with set_shaping().
+    #endif
+
   private:
 
     static block_t* current_block;          // A pointer to the block currently being traced
@@ -320,7 +335,7 @@ class Stepper {
       static constexpr uint8_t stepper_extruder = 0;
     #endif
 
-    #if ENABLED(S_CURVE_ACCELERATION)
+    #if ENABLED(HAS_BEZIER_S_CURVE)
       static int32_t bezier_A,     // A coefficient in Bézier speed curve
                      bezier_B,     // B coefficient in Bézier speed curve
                      bezier_C;     // C coefficient in Bézier speed curve
@@ -349,6 +364,90 @@ class Stepper {
       static page_step_state_t page_step_state;
     #endif
 
+    #if ENABLED(NATIVE_ARC_BLOCKS)
+      static uint32_t chord_events_left,    // Step events left in the current chord of an arc block (0 for lines)
+                      arc_chords_left,      // Chords not yet started
+                      arc_l_error, arc_e_error; // Spread the linear axis and E over the chords
+      static float arc_rvec_p, arc_rvec_q;  // Radius vector of the current chord's end (mm)
+      static int32_t arc_steps_p, arc_steps_q; // Steps from the start of the arc to the current chord's end
+    #endif
+
+    #if ENABLED(STEPPER_LEVELING)
+      static uint32_t level_divisor,        // Bresenham divisor for Z, which follows the pieces of a leveled block
+                      level_events_left;    // Step events left in the current piece of a leveled block (0 for others)
+      static uint8_t level_piece;           // The next piece to start
+    #endif
+
+    #if ENABLED(STEP_SCHEDULE)
+      enum StepEventType : uint8_t { SE_STEP, SE_DIRECTION, SE_BLOCK_START, SE_BLOCK_END };
+
+      typedef struct {
+        hal_timer_t ticks;      // Timer ticks from this event to the next one
+        StepEventType type;
+        uint8_t bits;           // Axes to step, direction bits, or the moving axes of a new block
+      } step_event_t;
+
+      typedef RingIndex<STEP_SCHEDULE_SIZE> schedule_ring_t;
+      typedef schedule_ring_t::type schedule_index_t;
+
+      static step_event_t schedule[STEP_SCHEDULE_SIZE];
+      static volatile schedule_index_t schedule_head,   // Events up to here are ready. Written by fill_schedule().
+                                       schedule_tail;   // The next event to run. Written by the Stepper ISR.
+      static schedule_index_t schedule_write;           // The next event to write, not yet ready
+      static uint8_t schedule_direction_bits;           // Direction bits as of the last written event
+      static bool schedule_in_block,                    // The Stepper ISR is between a block's start and end events
+                  schedule_pulsed;                      // A step pulse ended during this Stepper ISR
+      static hal_timer_t schedule_pulse_end;            // ...at this count
+
+      FORCE_INLINE static bool schedule_drained() { return schedule_write == schedule_tail; }
+
+      FORCE_INLINE static void schedule_event(const StepEventType type, const uint8_t bits=0) {
+        step_event_t &event = schedule[schedule_write];
+        event.ticks = 0;
+        event.type = type;
+        event.bits = bits;
+        schedule_write = schedule_ring_t::next(schedule_write);
+      }
+    #endif
+
+    #if HAS_SHAPING
+      typedef RingIndex<SHAPING_BUFFER_SIZE> shaping_ring_t;
+      typedef shaping_ring_t::type shaping_index_t;
+
+      static constexpr int16_t shaping_unit = 256;    // Impulse amplitudes are in 1/256 step
+      static constexpr uint8_t max_echoes = 2;
+
+      // The shaper of one axis, as used by the Stepper ISR
+      typedef struct {
+        uint8_t echoes;                               // Delayed impulses. 0 = Not shaped.
+        int16_t amplitude[max_echoes + 1];            // Share of the step in each impulse (sum = shaping_unit)
+        uint32_t delay[max_echoes];                   // Delay of each echo, in Stepper timer ticks
+        shaping_index_t echo_index[max_echoes];       // The next ring event due for each echo
+        int32_t error;                                // Shaped position minus motor position, in 1/256 step
+        int16_t steps;                                // Input steps in this Stepper ISR, kept for the echoes
+        bool reverse;                                 // The DIR pin is set for the negative direction
+      } shaper_t;
+
+      // The input steps of one Stepper ISR, kept until every echo has been played
+      typedef struct {
+        uint32_t time;                                // shaping_time of the Stepper ISR
+        int16_t steps[2];                             // X and Y steps (signed)
+      } shaping_event_t;
+
+      static shaper_t shaper[2];
+      static shaping_event_t shaping_ring[SHAPING_BUFFER_SIZE];
+      static volatile shaping_index_t shaping_head,   // The next event to write
+                                      shaping_tail;   // The oldest event some echo still needs
+      static uint32_t shaping_time,                   // Stepper timer ticks since boot (wraps)
+                      shaping_min_delay;              // Shortest echo delay of the shaped axes
+      static bool shaping_enabled;
+
+      static constexpr uint32_t SHAPING_NEVER = 0xFFFFFFFF;
+      static uint32_t nextShapingISR;
+
+      static void update_shaping();
+    #endif
+
     static int32_t ticks_nominal;
     #if DISABLED(S_CURVE_ACCELERATION)
       static uint32_t acc_step_rate; // needed for deceleration start point
@@ -409,12 +508,36 @@ class Stepper {
     // The stepper block processing ISR phase
     static uint32_t block_phase_isr();
 
+    #if ENABLED(STEP_SCHEDULE)
+      static uint32_t schedule_underruns;   // Count of times the step schedule ran dry in the middle of a block
+
+      // Trace planner blocks into the step schedule. Called from the Temperature ISR.
+      static void fill_schedule();
+
+      // The step schedule ISR phase. Run the due events and return the ticks to the next one.
+      static uint32_t schedule_phase_isr();
+    #endif
+
     #if ENABLED(LIN_ADVANCE)
       // The Linear advance ISR phase
       static uint32_t advance_isr();
       FORCE_INLINE static void initiateLA() { nextAdvanceISR = 0; }
     #endif
 
+    #if HAS_SHAPING
+      // The Input Shaping ISR phase. Play the due echoes and return the ticks to the next one.
+      static uint32_t shaping_isr();
+
+      // Steps of shaped axes are still to be played
+      static inline bool shaping_busy() { return shaping_head != shaping_tail; }
+
+      // Set the M593 settings of X or Y, after the pending moves and echoes are done
+      static void set_shaping(const AxisEnum axis, const shaping_settings_t &settings);
+
+      // Turn the shaping of all axes off (e.g., for homing) or back on
+      static void set_shaping_enabled(const bool enable);
+    #endif
+
     #if ENABLED(INTEGRATED_BABYSTEPPING)
       // The Babystepping ISR phase
       static uint32_t babystepping_isr();
@@ -451,8 +574,16 @@ class Stepper {
         if (IS_PAGE(current_block))
           page_manager.free_page(current_block->page_idx);
       #endif
+      #if ENABLED(STEP_SCHEDULE)
+        // The Stepper ISR counts the block as finished when it reaches the end event
+        if (!(current_block->flag & BLOCK_MASK_SYNC)) {
+          schedule_event(SE_BLOCK_END);
+          planner.scheduled_block_count++;
+        }
+      #else
+        axis_did_move = 0;
+      #endif
       current_block = nullptr;
-      axis_did_move = 0;
       planner.release_current_block();
     }
 
@@ -533,6 +664,14 @@ class Stepper {
 
   private:
 
+    #if ENABLED(NATIVE_ARC_BLOCKS)
+      static void next_arc_chord();
+    #endif
+
+    #if ENABLED(STEPPER_LEVELING)
+      static void next_level_piece();
+    #endif
+
     // Set the current position in steps
     static void _set_position(
       LOGICAL_AXIS_LIST(const int32_t &e, const int32_t &a, const int32_t &b, const int32_t &c)
@@ -601,9 +740,11 @@ class Stepper {
       return timer;
     }
 
-    #if ENABLED(S_CURVE_ACCELERATION)
+    #if ENABLED(HAS_BEZIER_S_CURVE)
       static void _calc_bezier_curve_coeffs(const int32_t v0, const int32_t v1, const uint32_t av);
       static int32_t _eval_bezier_curve(const uint32_t curr_step);
+    #elif ENABLED(S_CURVE_JERK_LIMITED)
+      static uint32_t _eval_jerk_ramp(const uint32_t t, const uint32_t ramp_time, const uint32_t jerk_time, const uint32_t rate_change);
     #endif
 
     #if HAS_MOTOR_CURRENT_SPI || HAS_MOTOR_CURRENT_PWM
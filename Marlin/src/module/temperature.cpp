@@ -162,7 +162,7 @@
   #include "../libs/private_spi.h"
 #endif
 
-#if ENABLED(PID_EXTRUSION_SCALING)
+#if EITHER(PID_EXTRUSION_SCALING, STEP_SCHEDULE)
   #include "stepper.h"
 #endif
 
@@ -221,6 +221,34 @@
   #endif
 #endif
 
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+  #define THERMISTOR_LOOKUP(N) thermistor_lookup_##N
+  #define _DEFINE_THERMISTOR_LOOKUP(N) constexpr thermistor_lookup_t THERMISTOR_LOOKUP(N) PROGMEM(TEMPTABLE_##N, TEMPTABLE_##N##_LEN)
+  #define DEFINE_THERMISTOR_LOOKUP(N) _DEFINE_THERMISTOR_LOOKUP(N);
+  #if HAS_HOTEND_THERMISTOR
+    #if ENABLED(TEMP_SENSOR_1_AS_REDUNDANT)
+      REPEAT(2, DEFINE_THERMISTOR_LOOKUP)
+      static const thermistor_lookup_t* heater_lookup_map[2] = { &THERMISTOR_LOOKUP(0), &THERMISTOR_LOOKUP(1) };
+    #else
+      REPEAT(HOTENDS, DEFINE_THERMISTOR_LOOKUP)
+      #define NEXT_THERMISTOR_LOOKUP(N) ,&THERMISTOR_LOOKUP(N)
+      static const thermistor_lookup_t* heater_lookup_map[HOTENDS] = ARRAY_BY_HOTENDS(&THERMISTOR_LOOKUP(0) REPEAT_S(1, HOTENDS, NEXT_THERMISTOR_LOOKUP));
+    #endif
+  #endif
+  #if TEMP_SENSOR_BED_IS_THERMISTOR
+    DEFINE_THERMISTOR_LOOKUP(BED)
+  #endif
+  #if TEMP_SENSOR_CHAMBER_IS_THERMISTOR
+    DEFINE_THERMISTOR_LOOKUP(CHAMBER)
+  #endif
+  #if TEMP_SENSOR_COOLER_IS_THERMISTOR
+    DEFINE_THERMISTOR_LOOKUP(COOLER)
+  #endif
+  #if TEMP_SENSOR_PROBE_IS_THERMISTOR
+    DEFINE_THERMISTOR_LOOKUP(PROBE)
+  #endif
+#endif
+
 Temperature thermalManager;
 
 const char str_t_thermal_runaway[] PROGMEM = STR_T_THERMAL_RUNAWAY,
@@ -1557,11 +1585,32 @@ void Temperature::manage_heater() {
 #define TEMP_AD595(RAW)  ((RAW) * 5.0 * 100.0 / float(HAL_ADC_RANGE) / (OVERSAMPLENR) * (TEMP_SENSOR_AD595_GAIN) + TEMP_SENSOR_AD595_OFFSET)
 #define TEMP_AD8495(RAW) ((RAW) * 6.6 * 100.0 / float(HAL_ADC_RANGE) / (OVERSAMPLENR) * (TEMP_SENSOR_AD8495_GAIN) + TEMP_SENSOR_AD8495_OFFSET)
 
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+
+/**
+ * Jump to the range of the 'raw' value with the direct lookup, then
+ * interpolate proportionally between the under and over values.
+ */
+#define SCAN_THERMISTOR_TABLE(TBL,LEN,LUT) do{                            \
+  const int32_t r = constrain(int32_t(raw), 0, int32_t(MAX_RAW_THERMISTOR_VALUE)); \
+  uint8_t m = pgm_read_byte(&(LUT).index[r / (THERMISTOR_LOOKUP_WIDTH)]); \
+  while (m < (LEN) && raw > int16_t(pgm_read_word(&TBL[m].value))) ++m;  \
+  if (!m) return celsius_t(pgm_read_word(&TBL[0].celsius));               \
+  if (m == (LEN)) return celsius_t(pgm_read_word(&TBL[(LEN)-1].celsius)); \
+  const int16_t v00 = pgm_read_word(&TBL[m-1].value),                     \
+                v10 = pgm_read_word(&TBL[m-0].value);                     \
+  const celsius_t v01 = celsius_t(pgm_read_word(&TBL[m-1].celsius)),      \
+                  v11 = celsius_t(pgm_read_word(&TBL[m-0].celsius));      \
+  return v01 + (raw - v00) * float(v11 - v01) / float(v10 - v00);         \
+}while(0)
+
+#else
+
 /**
  * Bisect search for the range of the 'raw' value, then interpolate
  * proportionally between the under and over values.
  */
-#define SCAN_THERMISTOR_TABLE(TBL,LEN) do{                                \
+#define SCAN_THERMISTOR_TABLE(TBL,LEN,...) do{                            \
   uint8_t l = 0, r = LEN, m;                                              \
   for (;;) {                                                              \
     m = (l + r) >> 1;                                                     \
@@ -1579,10 +1628,17 @@ void Temperature::manage_heater() {
   }                                                                       \
 }while(0)
 
+#endif
+
 #if HAS_USER_THERMISTORS
 
   user_thermistor_t Temperature::user_thermistor[USER_THERMISTORS]; // Initialized by settings.load()
 
+  #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+    // Temperatures (in 1/16 °C) at the start of each lookup bucket, updated along with the pre-calculations
+    static int16_t user_thermistor_lookup[USER_THERMISTORS][(THERMISTOR_LOOKUP_BUCKETS) + 1];
+  #endif
+
   void Temperature::reset_user_thermistors() {
     user_thermistor_t default_user_thermistor[USER_THERMISTORS] = {
       #if TEMP_SENSOR_0_IS_CUSTOM
@@ -1659,11 +1715,6 @@ void Temperature::manage_heater() {
   }
 
   celsius_float_t Temperature::user_thermistor_to_deg_c(const uint8_t t_index, const int16_t raw) {
-    //#if (MOTHERBOARD == BOARD_RAMPS_14_EFB)
-    //  static uint32_t clocks_total = 0;
-    //  static uint32_t calls = 0;
-    //  uint32_t tcnt5 = TCNT5;
-    //#endif
 
     if (!WITHIN(t_index, 0, COUNT(user_thermistor) - 1)) return 25;
 
@@ -1675,8 +1726,30 @@ void Temperature::manage_heater() {
       t.beta_recip   = 1.0f / t.beta;
       t.sh_alpha     = RECIPROCAL(THERMISTOR_RESISTANCE_NOMINAL_C - (THERMISTOR_ABS_ZERO_C))
                         - (t.beta_recip * t.res_25_log) - (t.sh_c_coeff * cu(t.res_25_log));
+
+      #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+        for (uint16_t b = 0; b <= (THERMISTOR_LOOKUP_BUCKETS); ++b) {
+          const int32_t b_raw = int32_t(b) * (THERMISTOR_LOOKUP_WIDTH);
+          const celsius_float_t c = user_thermistor_calc(t, _MIN(b_raw, int32_t(MAX_RAW_THERMISTOR_VALUE)));
+          user_thermistor_lookup[t_index][b] = LROUND(16 * constrain(c, -2000, 2000));
+        }
+      #endif
     }
 
+    #if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+      // Interpolate between the bucket temperatures
+      const int32_t r = constrain(int32_t(raw), 0, int32_t(MAX_RAW_THERMISTOR_VALUE));
+      const uint16_t b = r / (THERMISTOR_LOOKUP_WIDTH), f = r - b * (THERMISTOR_LOOKUP_WIDTH);
+      const int16_t * const tt = user_thermistor_lookup[t_index];
+      return (tt[b] * float((THERMISTOR_LOOKUP_WIDTH) - f) + tt[b + 1] * float(f)) * RECIPROCAL(16.0f * (THERMISTOR_LOOKUP_WIDTH));
+    #else
+      return user_thermistor_calc(t, raw);
+    #endif
+  }
+
+  // Steinhart-Hart conversion with the pre-calculated values
+  celsius_float_t Temperature::user_thermistor_calc(const user_thermistor_t &t, const int16_t raw) {
+
     // maximum adc value .. take into account the over sampling
     const int adc_max = MAX_RAW_THERMISTOR_VALUE,
               adc_raw = constrain(raw, 1, adc_max - 1); // constrain to prevent divide-by-zero
@@ -1691,14 +1764,6 @@ void Temperature::manage_heater() {
       value += t.sh_c_coeff * cu(log_resistance);
     value = 1.0f / value;
 
-    //#if (MOTHERBOARD == BOARD_RAMPS_14_EFB)
-    //  int32_t clocks = TCNT5 - tcnt5;
-    //  if (clocks >= 0) {
-    //    clocks_total += clocks;
-    //    calls++;
-    //  }
-    //#endif
-
     // Return degrees C (up to 999, as the LCD only displays 3 digits)
     return _MIN(value + THERMISTOR_ABS_ZERO_C, 999);
   }
@@ -1807,7 +1872,7 @@ void Temperature::manage_heater() {
     #if HAS_HOTEND_THERMISTOR
       // Thermistor with conversion table?
       const temp_entry_t(*tt)[] = (temp_entry_t(*)[])(heater_ttbl_map[e]);
-      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e]);
+      SCAN_THERMISTOR_TABLE((*tt), heater_ttbllen_map[e], *heater_lookup_map[e]);
     #endif
 
     return 0;
@@ -1820,7 +1885,7 @@ void Temperature::manage_heater() {
     #if TEMP_SENSOR_BED_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_BED, raw);
     #elif TEMP_SENSOR_BED_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_BED, TEMPTABLE_BED_LEN);
+      SCAN_THERMISTOR_TABLE(TEMPTABLE_BED, TEMPTABLE_BED_LEN, THERMISTOR_LOOKUP(BED));
     #elif TEMP_SENSOR_BED_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_BED_IS_AD8495
@@ -1838,7 +1903,7 @@ void Temperature::manage_heater() {
     #if TEMP_SENSOR_CHAMBER_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_CHAMBER, raw);
     #elif TEMP_SENSOR_CHAMBER_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN);
+      SCAN_THERMISTOR_TABLE(TEMPTABLE_CHAMBER, TEMPTABLE_CHAMBER_LEN, THERMISTOR_LOOKUP(CHAMBER));
     #elif TEMP_SENSOR_CHAMBER_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_CHAMBER_IS_AD8495
@@ -1856,7 +1921,7 @@ void Temperature::manage_heater() {
     #if TEMP_SENSOR_COOLER_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_COOLER, raw);
     #elif TEMP_SENSOR_COOLER_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_COOLER, TEMPTABLE_COOLER_LEN);
+      SCAN_THERMISTOR_TABLE(TEMPTABLE_COOLER, TEMPTABLE_COOLER_LEN, THERMISTOR_LOOKUP(COOLER));
     #elif TEMP_SENSOR_COOLER_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_COOLER_IS_AD8495
@@ -1874,7 +1939,7 @@ void Temperature::manage_heater() {
     #if TEMP_SENSOR_PROBE_IS_CUSTOM
       return user_thermistor_to_deg_c(CTI_PROBE, raw);
     #elif TEMP_SENSOR_PROBE_IS_THERMISTOR
-      SCAN_THERMISTOR_TABLE(TEMPTABLE_PROBE, TEMPTABLE_PROBE_LEN);
+      SCAN_THERMISTOR_TABLE(TEMPTABLE_PROBE, TEMPTABLE_PROBE_LEN, THERMISTOR_LOOKUP(PROBE));
     #elif TEMP_SENSOR_PROBE_IS_AD595
       return TEMP_AD595(raw);
     #elif TEMP_SENSOR_PROBE_IS_AD8495
@@ -3320,6 +3385,9 @@ void Temperature::isr() {
 
   // Periodically call the planner timer service routine
   planner.isr();
+
+  // Trace the next steps into the step schedule
+  TERN_(STEP_SCHEDULE, stepper.fill_schedule());
 }
 
 #if HAS_TEMP_SENSOR
@@ -24,7 +24,7 @@
 #define REVERSE_TEMP_SENSOR_RANGE_201 1
 
 // Pt100 with LMV324 amp on Overlord v1.1 electronics
-const temp_entry_t temptable_201[] PROGMEM = {
+constexpr temp_entry_t temptable_201[] PROGMEM = {
   { OV(   0),   0 },
   { OV(   8),   1 },
   { OV(  23),   6 },
@@ -28,7 +28,7 @@
 
 // Pt100 with INA826 amplifier board with 5v supply based on Thermistor 20, with 3v3 ADC reference on the mainboard.
 // If the ADC reference and INA826 board supply voltage are identical, Thermistor 20 instead.
-const temp_entry_t temptable_21[] PROGMEM = {
+constexpr temp_entry_t temptable_21[] PROGMEM = {
   { OV(  0),    0 },
   { OV(227),    1 },
   { OV(236),   10 },
@@ -22,7 +22,7 @@
 #pragma once
 
 // R25 = 100 kOhm, beta25 = 4120 K, 4.7 kOhm pull-up, mendel-parts
-const temp_entry_t temptable_3[] PROGMEM = {
+constexpr temp_entry_t temptable_3[] PROGMEM = {
   { OV(   1), 864 },
   { OV(  21), 300 },
   { OV(  25), 290 },
@@ -198,7 +198,7 @@ typedef struct { int16_t value; celsius_t celsius; } temp_entry_t;
   #include "thermistor_999.h"
 #endif
 #if ANY_THERMISTOR_IS(1000) // Custom
-  const temp_entry_t temptable_1000[] PROGMEM = { { 0, 0 } };
+  constexpr temp_entry_t temptable_1000[] PROGMEM = { { 0, 0 } };
 #endif
 
 #define _TT_NAME(_N) temptable_ ## _N
@@ -331,6 +331,31 @@ static_assert(
   "Temperature conversion tables over 255 entries need special consideration."
 );
 
+#if ENABLED(THERMISTOR_DIRECT_LOOKUP)
+
+  // Raw values covered by each lookup bucket
+  #define THERMISTOR_LOOKUP_WIDTH ((MAX_RAW_THERMISTOR_VALUE + (THERMISTOR_LOOKUP_BUCKETS)) / (THERMISTOR_LOOKUP_BUCKETS))
+
+  /**
+   * Direct lookup for a conversion table, built at compile time. Each bucket holds
+   * the index of the first table entry at or above the bucket's lowest raw value,
+   * so the entry for any raw value is at most a step or two beyond it.
+   */
+  struct thermistor_lookup_t {
+    uint8_t index[THERMISTOR_LOOKUP_BUCKETS];
+
+    constexpr thermistor_lookup_t(const temp_entry_t * const tbl, const uint8_t len) : index() {
+      uint8_t i = 0;
+      for (uint16_t b = 0; b < THERMISTOR_LOOKUP_BUCKETS; ++b) {
+        const int32_t raw = int32_t(b) * (THERMISTOR_LOOKUP_WIDTH);
+        while (i < len && tbl[i].value < raw) ++i;
+        index[b] = i;
+      }
+    }
+  };
+
+#endif
+
 // Set the high and low raw values for the heaters
 // For thermistors the highest temperature results in the lowest ADC value
 // For thermocouples the highest temperature results in the highest ADC value
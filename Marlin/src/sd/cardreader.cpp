@@ -141,6 +141,11 @@ SdFile CardReader::file;
 
 uint32_t CardReader::filesize, CardReader::sdpos;
 
+#if HAS_SD_READ_AHEAD
+  uint8_t CardReader::ahead_buf[(SD_READ_AHEAD_SECTORS) * 512];
+  uint16_t CardReader::ahead_pos, CardReader::ahead_len;
+#endif
+
 CardReader::CardReader() {
   changeMedia(&
     #if SHARED_VOLUME_IS(SD_ONBOARD)
@@ -539,6 +544,7 @@ void CardReader::endFilePrintNow(TERN_(SD_RESORT, const bool re_sort/*=false*/))
   TERN_(DWIN_CREALITY_LCD, HMI_flag.print_finish = flag.sdprinting);
   flag.abort_sd_printing = false;
   if (isFileOpen()) file.close();
+  resetReadAhead();
   TERN_(SD_RESORT, if (re_sort) presort());
 }
 
@@ -645,6 +651,7 @@ void CardReader::openFileRead(const char * const path, const uint8_t subcall_typ
   if (file.open(diveDir, fname, O_READ)) {
     filesize = file.fileSize();
     sdpos = 0;
+    resetReadAhead();
 
     { // Don't remove this block, as the PORT_REDIRECT is a RAII
       PORT_REDIRECT(SerialMask::All);
@@ -820,6 +827,7 @@ void CardReader::closefile(const bool store_location/*=false*/) {
   file.close();
   flag.saving = flag.logging = false;
   sdpos = 0;
+  resetReadAhead();
   TERN_(EMERGENCY_PARSER, emergency_parser.enable());
 
   if (store_location) {
@@ -1243,11 +1251,30 @@ uint16_t CardReader::get_num_Files() {
   );
 }
 
+#if HAS_SD_READ_AHEAD
+
+  /**
+   * Refill the read-ahead buffer from the current file position. The first
+   * read stops at a sector boundary so the following ones are whole, aligned
+   * sectors that SdBaseFile::read copies without going through the volume cache.
+   * Return false at the end of the file or on a read error.
+   */
+  bool CardReader::fillReadAhead() {
+    sdpos = file.curPosition();
+    const int16_t n = file.read(ahead_buf, sizeof(ahead_buf) - (sdpos & 0x1FF));
+    ahead_pos = 0;
+    ahead_len = n > 0 ? n : 0;
+    return ahead_len > 0;
+  }
+
+#endif
+
 //
 // Return from procedure or close out the Print Job
 //
 void CardReader::fileHasFinished() {
   file.close();
+  resetReadAhead();
   #if HAS_MEDIA_SUBCALLS
     if (file_subcall_ctr > 0) { // Resume calling file after closing procedure
       file_subcall_ctr--;
@@ -218,10 +218,29 @@ public:
   static inline bool eof()              { return getIndex() >= getFileSize(); }
 
   // File data operations
-  static inline int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
-  static inline int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+  #if HAS_SD_READ_AHEAD
+    // Serve bytes from the read-ahead buffer, refilling it a burst of sectors at a time
+    static inline int16_t get() {
+      if (ahead_pos >= ahead_len && !fillReadAhead()) { sdpos = file.curPosition(); return -1; }
+      sdpos++;
+      return ahead_buf[ahead_pos++];
+    }
+    static inline int16_t read(void *buf, uint16_t nbyte)  { dropReadAhead(); return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static inline void setIndex(const uint32_t index) {
+      const uint32_t start = sdpos - ahead_pos;             // File index of ahead_buf[0]
+      if (index >= start && index < start + ahead_len)      // Still in the buffer?
+        ahead_pos = (sdpos = index) - start;
+      else {
+        resetReadAhead();
+        file.seekSet((sdpos = index));
+      }
+    }
+  #else
+    static inline int16_t get()                            { int16_t out = (int16_t)file.read(); sdpos = file.curPosition(); return out; }
+    static inline int16_t read(void *buf, uint16_t nbyte)  { return file.isOpen() ? file.read(buf, nbyte) : -1; }
+    static inline void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
+  #endif
   static inline int16_t write(void *buf, uint16_t nbyte) { return file.isOpen() ? file.write(buf, nbyte) : -1; }
-  static inline void setIndex(const uint32_t index)      { file.seekSet((sdpos = index)); }
 
   // TODO: rename to diskIODriver()
   static DiskIODriver* diskIODriver() { return driver; }
@@ -313,6 +332,23 @@ private:
   static uint32_t filesize, // Total size of the current file, in bytes
                   sdpos;    // Index most recently read (one behind file.getPos)
 
+  //
+  // Read-ahead buffer. While it holds unread bytes the file position is
+  // ahead of sdpos, which stays the logical position of the print.
+  //
+  #if HAS_SD_READ_AHEAD
+    static uint8_t ahead_buf[(SD_READ_AHEAD_SECTORS) * 512];
+    static uint16_t ahead_pos, ahead_len;
+    static bool fillReadAhead();
+    static inline void resetReadAhead() { ahead_pos = ahead_len = 0; }
+    static inline void dropReadAhead() {
+      if (ahead_pos < ahead_len) file.seekSet(sdpos); // Rewind to the logical position
+      resetReadAhead();
+    }
+  #else
+    static inline void resetReadAhead() {}
+  #endif
+
   //
   // Procedure calls to other files
   //
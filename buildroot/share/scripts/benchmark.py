@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""
+Planner / stepper throughput benchmark for the LINUX simulator.
+
+Generates synthetic G-code workloads, replays each one through a native
+build of Marlin with --benchmark (deterministic virtual time) and collects
+planner throughput, starvation and ISR latency figures. Save the results
+with --save and compare a later build against them with --compare.
+
+  benchmark.py -m .pio/build/linux_native/program --save before.json
+  benchmark.py -m .pio/build/linux_native/program --compare before.json
+"""
+
+import argparse, json, math, os, re, subprocess, sys, tempfile
+
+HEADER = "M302 P1\nG21\nG90\nM83\nG92 X100 Y100 Z10 E0\n"
+
+def circle_segments(n=4000, r=40.0, f=6000):
+    """Many very short linear segments: the common slicer arc case."""
+    out = [HEADER, "G1 X%.3f Y100 F%d\n" % (100 + r, f)]
+    for i in range(1, n + 1):
+        a = 2 * math.pi * i / 400
+        out.append("G1 X%.3f Y%.3f E0.01\n" % (100 + r * math.cos(a), 100 + r * math.sin(a)))
+    return "".join(out)
+
+def arcs(n=200, r=30.0, f=6000):
+    """Full G2/G3 arcs, planned as segments by the firmware."""
+    out = [HEADER, "G1 X%.3f Y100 F%d\n" % (100 + r, f)]
+    for i in range(n):
+        out.append("%s X%.3f Y100 I%.3f J0 E1\n" % ("G2" if i % 2 else "G3", 100 + r, -r))
+    return "".join(out)
+
+def arcfit(n=1500, f=6000):
+    """Arc-fitted perimeters (ArcWelder style): short G2/G3 arcs of varying radius."""
+    out = [HEADER, "G1 X100 Y100 F%d\n" % f]
+    x, y, heading = 100.0, 100.0, 0.0
+    for i in range(n):
+        r = 5 + 25 * (0.5 + 0.5 * math.sin(i * 0.37))       # 5 to 30mm radius
+        sweep = math.radians(10 + 50 * (0.5 + 0.5 * math.cos(i * 0.23)))
+        ccw = (i // 7) % 2 == 0
+        side = 1 if ccw else -1
+        cx, cy = x - side * r * math.sin(heading), y + side * r * math.cos(heading)
+        a0 = math.atan2(y - cy, x - cx)
+        a1 = a0 + side * sweep
+        nx, ny = cx + r * math.cos(a1), cy + r * math.sin(a1)
+        # Stay on the bed by steering back toward the middle
+        if not (40 < nx < 160 and 40 < ny < 160):
+            heading = math.atan2(100 - y, 100 - x)
+            out.append("G1 X%.3f Y%.3f E0.2\n" % (x + 2 * math.cos(heading), y + 2 * math.sin(heading)))
+            x, y = x + 2 * math.cos(heading), y + 2 * math.sin(heading)
+            continue
+        out.append("%s X%.3f Y%.3f I%.3f J%.3f E%.4f\n" % ("G3" if ccw else "G2", nx, ny, cx - x, cy - y, r * sweep * 0.03))
+        x, y, heading = nx, ny, heading + side * sweep
+    return "".join(out)
+
+def infill(n=2000, w=60.0, step=0.4, f=9000):
+    """Zig-zag infill: long straight moves with sharp reversals."""
+    out = [HEADER, "G1 X70 Y70 F%d\n" % f]
+    for i in range(n):
+        x = 70 + (w if i % 2 == 0 else 0)
+        y = 70 + (i // 2) * step % w
+        out.append("G1 X%.3f Y%.3f E0.5\n" % (x, y))
+        out.append("G1 Y%.3f E0.01\n" % (y + step))
+    return "".join(out)
+
+def spiral(n=3000, f=3000):
+    """Vase-mode spiral: simultaneous X, Y and Z on every segment."""
+    out = [HEADER, "G1 F%d\n" % f]
+    for i in range(n):
+        a = 2 * math.pi * i / 100
+        r = 20 + 5 * math.sin(a * 3)
+        out.append("G1 X%.3f Y%.3f Z%.4f E0.02\n" % (100 + r * math.cos(a), 100 + r * math.sin(a), 10 + i * 0.002))
+    return "".join(out)
+
+def curves(n=48, f=12000):
+    """Circles of short segments, as sliced for holes and round details."""
+    out = [HEADER, "G1 F%d\n" % f]
+    for i in range(n):
+        r = 5 + 20 * (i % 4) / 3.0                          # 5 to 25mm radius
+        seg = 0.4 * (1 + i // 4 % 4)                        # 0.4 to 1.6mm segments
+        steps = int(2 * math.pi * r / seg)
+        out.append("G0 X%.3f Y100\n" % (100 + r))
+        for k in range(1, steps + 1):
+            a = 2 * math.pi * k / steps
+            out.append("G1 X%.3f Y%.3f E0.01\n" % (100 + r * math.cos(a), 100 + r * math.sin(a)))
+    return "".join(out)
+
+def delta(n=400, r=100.0, f=6000):
+    """Long straight chords across a round bed centered on 0,0 (for DELTA builds)."""
+    out = [HEADER.replace("X100 Y100", "X0 Y0"), "G1 X%.3f Y0 F%d\n" % (r, f)]
+    for i in range(1, n + 1):
+        a = i * 2.4  # Golden angle spreads the chords around the bed
+        out.append("G1 X%.3f Y%.3f E0.5\n" % (r * math.cos(a), r * math.sin(a)))
+    return "".join(out)
+
+WORKLOADS = { "circle": circle_segments, "arcs": arcs, "arcfit": arcfit, "curves": curves, "infill": infill, "spiral": spiral, "delta": delta }
+
+def parse(report):
+    """Turn the simulator's stderr report into a dictionary."""
+    r = {}
+    m = re.search(r"Simulated ([\d.]+)s in ([\d.]+)s", report)
+    if m: r["simulated_s"], r["wall_s"] = float(m.group(1)), float(m.group(2))
+    m = re.search(r"Blocks: (\d+) \(([\d.]+)/s simulated, ([\d.]+)/s of main thread CPU\)", report)
+    if m: r["blocks"], r["blocks_per_s"], r["blocks_per_cpu_s"] = int(m.group(1)), float(m.group(2)), float(m.group(3))
+    m = re.search(r"Starvations: (\d+) \(([\d.]+)s starved\)", report)
+    if m: r["starvations"], r["starved_s"] = int(m.group(1)), float(m.group(2))
+    for m in re.finditer(r"(\w[\w ]*) ISR: (\d+) calls, mean (\d+)ns, p50 (\d+)ns, p99 (\d+)ns, p99.9 (\d+)ns, max (\d+)ns", report):
+        r[m.group(1).lower() + "_isr"] = dict(zip(("calls", "mean", "p50", "p99", "p999", "max"), map(int, m.groups()[1:])))
+    m = re.search(r"Block ring: (\d+) blocks, (\d+) index order errors", report)
+    if m: r["block_buffer_size"], r["ring_errors"] = int(m.group(1)), int(m.group(2))
+    m = re.search(r"Step schedule: (\d+) events, (\d+) underruns", report)
+    if m: r["schedule_size"], r["schedule_underruns"] = int(m.group(1)), int(m.group(2))
+    m = re.search(r"Planner lookahead: (\d+) calls, mean (\d+)ns, p50 (\d+)ns, p99 (\d+)ns, p99.9 (\d+)ns, max (\d+)ns", report)
+    if m: r["lookahead"] = dict(zip(("calls", "mean", "p50", "p99", "p999", "max"), map(int, m.groups())))
+    m = re.search(r"Head acceleration: (\d+) samples, p50 (\d+)mm/s2, p99 (\d+)mm/s2, max (\d+)mm/s2, ([\d.]+)% over", report)
+    if m: r["head_accel"] = dict(zip(("samples", "p50", "p99", "max"), map(int, m.groups()[:4])), over_pct=float(m.group(5)))
+    return r
+
+def run(marlin, gcode, extra):
+    with tempfile.TemporaryDirectory() as cwd:  # Keep eeprom.dat out of the picture
+        p = subprocess.run([os.path.abspath(marlin), "--benchmark"] + extra, input=gcode.encode(),
+                           stdout=subprocess.DEVNULL, stderr=subprocess.PIPE, cwd=cwd)
+    report = p.stderr.decode(errors="replace")
+    if p.returncode: sys.exit("%s exited with %d:\n%s" % (marlin, p.returncode, report))
+    return report
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-m", "--marlin", required=True, help="LINUX simulator binary")
+    parser.add_argument("-w", "--workload", action="append", choices=sorted(WORKLOADS), help="Workload(s) to run (default: all but delta)")
+    parser.add_argument("-n", "--runs", type=int, default=3, help="Keep the best of N runs per workload (default=3)")
+    parser.add_argument("--cpu-scale", type=float, help="Pass --cpu-scale to the simulator")
+    parser.add_argument("--dump", metavar="DIR", help="Also write the generated G-code to DIR")
+    parser.add_argument("--save", metavar="JSON", help="Save the results")
+    parser.add_argument("--compare", metavar="JSON", help="Compare against saved results")
+    parser.add_argument("-v", "--verbose", action="store_true", help="Print the full simulator reports")
+    args = parser.parse_args()
+
+    extra = ["--cpu-scale=%g" % args.cpu_scale] if args.cpu_scale else []
+    baseline = json.load(open(args.compare)) if args.compare else {}
+    results = {}
+    for name in args.workload or sorted(set(WORKLOADS) - {"delta"}):
+        gcode = WORKLOADS[name]()
+        if args.dump:
+            with open(os.path.join(args.dump, name + ".gcode"), "w") as f: f.write(gcode)
+        # Virtual time makes everything but the host timings identical between
+        # runs, so keep the run least disturbed by the rest of the host
+        best = None
+        for _ in range(max(1, args.runs)):
+            report = run(args.marlin, gcode, extra)
+            r = parse(report)
+            if not best or r.get("blocks_per_cpu_s", 0) > best[0].get("blocks_per_cpu_s", 0): best = (r, report)
+        r, report = best
+        if args.verbose: print("== %s ==\n%s" % (name, report))
+        results[name] = r
+        isr, la = r.get("stepper_isr", {}), r.get("lookahead", {})
+        line = "%-8s %6d blocks %9.1f blocks/CPU-s  %3d starvations  lookahead %6dns/block  stepper ISR mean %5dns p99 %6dns max %7dns" % (
+            name, r.get("blocks", 0), r.get("blocks_per_cpu_s", 0), r.get("starvations", 0), la.get("mean", 0),
+            isr.get("mean", 0), isr.get("p99", 0), isr.get("max", 0))
+        if name in baseline:
+            b = baseline[name]
+            if b.get("blocks_per_cpu_s"): line += "  throughput %+.1f%%" % (100 * (r["blocks_per_cpu_s"] / b["blocks_per_cpu_s"] - 1))
+            if b.get("lookahead", {}).get("mean"): line += "  lookahead %+.1f%%" % (100 * (la.get("mean", 0) / b["lookahead"]["mean"] - 1))
+            if b.get("stepper_isr", {}).get("mean"): line += "  ISR mean %+.1f%%" % (100 * (isr.get("mean", 0) / b["stepper_isr"]["mean"] - 1))
+            # Motion should be the same, e.g. between the float and fixed-point planners
+            if b.get("simulated_s"): line += "  print time %+.3f%%" % (100 * (r.get("simulated_s", 0) / b["simulated_s"] - 1))
+        if "head_accel" in r: line += "  accel p99 %5dmm/s2 (%.1f%% over limit)" % (r["head_accel"]["p99"], r["head_accel"]["over_pct"])
+        if "schedule_underruns" in r: line += "  %d schedule underruns" % r["schedule_underruns"]
+        if r.get("ring_errors"): line += "  %d BLOCK RING ORDER ERRORS" % r["ring_errors"]
+        print(line)
+
+    if args.save:
+        with open(args.save, "w") as f: json.dump(results, f, indent=2)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""
+Convert G-code to Marlin's pre-tokenized binary command format.
+
+Requires BINARY_GCODE_COMMANDS. Motion and other purely numeric commands are
+encoded as binary frames, which the firmware parses without any text scanning.
+Everything else (string arguments, SD and host commands, M808 markers, etc.)
+is passed through as ordinary text, so the output can be printed from SD or
+streamed to the printer in place of the original file.
+
+  gcode_binary.py input.gcode output.bgc
+
+Frame layout (see parser.h):
+
+  0x01, length, letter, codenum (uint16), subcode,
+  { tag (type << 5 | letter - 'A'), [int32 | float] } ...,
+  checksum (XOR of length and everything after it)
+"""
+
+import argparse, re, struct, sys
+
+MARK = 0x01
+PARAM_NONE, PARAM_INT, PARAM_FLOAT = 0, 1, 2
+MAX_CMD_SIZE = 96
+
+# M-codes that take only numeric parameters and aren't inspected before parsing
+NUMERIC_MCODES = { 17, 18, 82, 83, 84, 104, 106, 107, 109, 140, 190, 201, 203, 204, 205, 220, 221, 400 }
+
+COMMAND = re.compile(r"^([GM])(\d+)(?:\.(\d+))?(.*)$")
+PARAM = re.compile(r"\s*([A-Z])\s*([-+]?(?:\d+\.?\d*|\.\d+))?")
+
+def encode(line, max_size=MAX_CMD_SIZE):
+    """Return the binary frame for a line, or None if it must stay as text."""
+    m = COMMAND.match(line)
+    if not m: return None
+    letter, codenum, subcode, rest = m.group(1), int(m.group(2)), int(m.group(3) or 0), m.group(4)
+    if letter == 'M' and codenum not in NUMERIC_MCODES: return None
+    if codenum > 0xFFFF or subcode > 0xFF: return None
+
+    payload = bytearray(struct.pack("<cHB", letter.encode(), codenum, subcode))
+    pos = 0
+    while pos < len(rest):
+        p = PARAM.match(rest, pos)
+        if not p or p.end() == pos: return None   # Not a plain parameter list
+        pos = p.end()
+        ind, value = ord(p.group(1)) - ord('A'), p.group(2)
+        if value is None:
+            payload.append(PARAM_NONE << 5 | ind)
+        elif re.fullmatch(r"[-+]?\d+", value) and -2**31 <= int(value) < 2**32:
+            payload.append(PARAM_INT << 5 | ind)
+            payload += struct.pack("<I", int(value) & 0xFFFFFFFF)
+        else:
+            payload.append(PARAM_FLOAT << 5 | ind)
+            payload += struct.pack("<f", float(value))
+
+    if len(payload) + 2 > max_size: return None
+    frame = bytearray([MARK, len(payload)]) + payload
+    checksum = 0
+    for b in frame[1:]: checksum ^= b
+    return bytes(frame + bytearray([checksum]))
+
+def strip(line):
+    """Remove comments, line numbers and checksums, as the firmware would."""
+    line = line.split(';', 1)[0]
+    line = re.sub(r"\([^)]*\)", "", line)
+    line = re.sub(r"^\s*N\d+\s*", "", line)
+    line = re.sub(r"\*\d+\s*$", "", line)
+    return line.strip()
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="G-code file")
+    parser.add_argument("output", help="Output file")
+    parser.add_argument("--max-cmd-size", type=int, default=MAX_CMD_SIZE, help="MAX_CMD_SIZE of the firmware (default=%d)" % MAX_CMD_SIZE)
+    args = parser.parse_args()
+
+    size_in = size_out = binary = text = 0
+    with open(args.input, "r", errors="replace") as fin, open(args.output, "wb") as fout:
+        for raw in fin:
+            size_in += len(raw)
+            line = strip(raw)
+            if not line: continue
+            frame = None if '"' in line else encode(line.upper() if line[0] in "gm" else line, args.max_cmd_size)
+            if frame:
+                binary += 1
+            else:
+                frame = (line + "\n").encode()
+                text += 1
+            fout.write(frame)
+            size_out += len(frame)
+
+    print("%d binary and %d text commands, %d -> %d bytes" % (binary, text, size_in, size_out), file=sys.stderr)
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,282 @@
+#!/usr/bin/env python3
+"""
+Host streaming throughput against the LINUX simulator.
+
+Streams G-code to a real-time simulator (no --virtual-time) over its stdin
+and stdout in each of the ways that M576 offers, and reports the lines per
+second and the bytes sent:
+
+  ok        Numbered lines, waiting for an "ok" after each, as most hosts do
+  window    Numbered lines with credit for a window of them (STREAM_WINDOW)
+  packet    BinaryStream packets of plain text (BINARY_GCODE_STREAM)
+  packet-hs BinaryStream packets of heatshrink compressed text
+
+Responses are held back by --latency to stand in for the round trip of a USB
+or serial link. --corrupt damages every n-th line or packet once to exercise
+"Resend:" and "rs" recovery.
+
+  host_stream.py -m .pio/build/linux_native/program [-f print.gcode] [--latency 1]
+"""
+
+import argparse, queue, re, struct, subprocess, sys, threading, time
+
+CREDIT = re.compile(r"^ok N(-?\d+) R(-?\d+)")
+MODE = re.compile(r"^Stream mode:(\d)(?: L(\d+) B(\d+))?(?: P(\d+))?")
+PACKET_OK = re.compile(r"^ok(\d+)$")
+PACKET_RESEND = re.compile(r"^rs(\d+)$")
+
+class Link:
+    """The simulator's serial port, with responses delayed by the link latency."""
+    def __init__(self, program, latency):
+        self.proc = subprocess.Popen([program], stdin=subprocess.PIPE, stdout=subprocess.PIPE, bufsize=0)
+        self.latency, self.lines, self.held, self.sent = latency, queue.Queue(), None, 0
+        threading.Thread(target=self.reader, daemon=True).start()
+
+    def reader(self):
+        for raw in self.proc.stdout:
+            self.lines.put((time.monotonic() + self.latency, raw.decode(errors="replace").strip()))
+        self.lines.put((0, None))
+
+    def write(self, data):
+        self.proc.stdin.write(data)
+        self.proc.stdin.flush()
+        self.sent += len(data)
+
+    def readline(self, timeout):
+        """The next response that has made it across the link, or '' on timeout."""
+        end = time.monotonic() + timeout
+        if self.held is None:
+            try: self.held = self.lines.get(timeout=timeout)
+            except queue.Empty: return ""
+        due, line = self.held
+        if line is None: sys.exit("The simulator exited")
+        if due > end: time.sleep(max(0, end - time.monotonic())); return ""
+        time.sleep(max(0, due - time.monotonic()))
+        self.held = None
+        return line
+
+    def close(self):
+        self.proc.kill()
+        self.proc.wait()
+
+def numbered(n, cmd, corrupt=False):
+    line = "N%d %s" % (n, cmd)
+    cs = 0
+    for c in line.encode(): cs ^= c
+    if corrupt: cs ^= 0x55
+    return ("%s*%d\n" % (line, cs)).encode()
+
+def command(link, cmd, expect="ok", timeout=5):
+    """Send an unnumbered command and return its response lines up to the one starting with expect."""
+    link.write((cmd + "\n").encode())
+    out, end = [], time.monotonic() + timeout
+    while time.monotonic() < end:
+        line = link.readline(0.1)
+        if line:
+            out.append(line)
+            if line.startswith(expect): return out
+    sys.exit("No response to " + cmd)
+
+def connect(program, latency):
+    link = Link(program, latency)
+    for _ in range(20):                       # The simulator is ready when M110 is answered
+        link.write(b"M110 N0\n")
+        while True:
+            line = link.readline(0.5)
+            if not line or line.startswith("ok"): break
+        if line:
+            while link.readline(0.5): pass    # Answers to the earlier tries
+            return link
+    sys.exit("No response from " + program)
+
+def stream_mode(link, mode):
+    """Switch with M576 and return its report."""
+    for line in command(link, "M576 S%d" % mode, "Stream mode:"):
+        if line.startswith("?"): sys.exit("M576 S%d isn't available" % mode)
+    m = MODE.match(line)
+    if int(m.group(1)) != mode: sys.exit("M576 S%d was refused" % mode)
+    return m
+
+class Corrupter:
+    """Damage every n-th item once."""
+    def __init__(self, every): self.every, self.done = every, set()
+    def __call__(self, n):
+        bad = self.every and n % self.every == 0 and n not in self.done
+        if bad: self.done.add(n)
+        return bad
+
+def stream_ok(link, cmds, corrupt):
+    """One line, then wait for its "ok"."""
+    bad, resends, n, last = Corrupter(corrupt), 0, 1, len(cmds)
+    while n <= last:
+        link.write(numbered(n, cmds[n - 1], bad(n)))
+        resend = None
+        while True:
+            line = link.readline(5)
+            if not line: sys.exit("Timed out waiting for ok on line %d" % n)
+            if line.startswith("Resend:"): resend = int(line.split(":")[1])
+            elif line.startswith("ok"): break
+        if resend is None: n += 1
+        else: n, resends = resend, resends + 1
+    return resends
+
+def stream_window(link, cmds, corrupt):
+    """Send while there's credit, and take credit as it comes."""
+    link.write(numbered(1, "M576 S1"))
+    bad, resends = Corrupter(corrupt), 0
+    lines = size = done = read = None
+    while lines is None or done is None:
+        line = link.readline(5)
+        if not line: sys.exit("No response to M576")
+        m = MODE.match(line)
+        if m:
+            if m.group(1) != "1": sys.exit("M576 S1 was refused")
+            lines, size = int(m.group(2)), int(m.group(3))
+        m = CREDIT.match(line)
+        if m: done, read = int(m.group(1)), int(m.group(2))
+    first = 2
+    last, n, sent = first + len(cmds) - 1, first, {}
+    while done < last:
+        while n <= last and n <= done + lines:
+            data = numbered(n, cmds[n - first], bad(n))
+            if sum(v for k, v in sent.items() if k > read) + len(data) > size: break
+            link.write(data)
+            sent[n] = len(data)
+            n += 1
+        line = link.readline(5)
+        if not line: sys.exit("Timed out waiting for credit at line %d" % n)
+        if line.startswith("Resend:"):
+            n = int(line.split(":")[1])
+            sent = { k: v for k, v in sent.items() if k < n }
+            resends += 1
+            continue
+        m = CREDIT.match(line)
+        if m:
+            done, read = int(m.group(1)), int(m.group(2))
+            sent = { k: v for k, v in sent.items() if k > read }
+    link.write(numbered(last + 1, "M576 S0"))
+    while not link.readline(5).startswith("Stream mode:0"): pass
+    while link.readline(5) != "ok": pass
+    return resends
+
+def fletcher16(data, cs=0):
+    for b in data:
+        low = ((cs & 0xFF) + b) % 255
+        cs = ((((cs >> 8) + low) % 255) << 8) | low
+    return cs
+
+def packet(sync, protocol, ptype, payload=b"", corrupt=False):
+    """A BinaryStream packet (see feature/binary_stream.h)."""
+    header = struct.pack("<BBH", sync & 0xFF, protocol << 4 | ptype, len(payload))
+    header += struct.pack("<H", fletcher16(header))
+    footer = fletcher16(header + payload) ^ (0x5555 if corrupt else 0)
+    return struct.pack("<H", 0xB5AD) + header + payload + struct.pack("<H", footer)
+
+def heatshrink(data, window_bits=8, lookahead_bits=4):
+    """Compress as one heatshrink stream: a 1 bit and a literal byte, or a 0 bit and a back-reference."""
+    window, lookahead = 1 << window_bits, 1 << lookahead_bits
+    bits, nbits, out, recent = 0, 0, bytearray(), {}
+    def put(value, count):
+        nonlocal bits, nbits
+        bits, nbits = bits << count | value, nbits + count
+        while nbits >= 8:
+            nbits -= 8
+            out.append(bits >> nbits & 0xFF)
+        bits &= (1 << nbits) - 1
+    i = 0
+    while i < len(data):
+        best, dist = 1, 0
+        for j in reversed(recent.get(data[i:i + 2], ())):
+            if i - j > window: break
+            l = 2
+            while l < lookahead and i + l < len(data) and data[j + l] == data[i + l]: l += 1
+            if l > best: best, dist = l, i - j
+            if l == lookahead: break
+        if dist:
+            put(0, 1); put(dist - 1, window_bits); put(best - 1, lookahead_bits)
+        else:
+            put(1, 1); put(data[i], 8)
+        for k in range(i, i + best):
+            recent.setdefault(data[k:k + 2], []).append(k)
+        i += best
+    if nbits: put(0, 8 - nbits)
+    return bytes(out)
+
+def stream_packets(link, cmds, corrupt, compress, ahead=2):
+    """Packets of G-code, up to 'ahead' of them unacknowledged, going back to the one asked for."""
+    size = int(stream_mode(link, 2).group(4))
+    while link.readline(5) != "ok": pass
+    text = "".join(c + "\n" for c in cmds).encode()
+    data = heatshrink(text) if compress else text
+    chunks = [data[i:i + size] for i in range(0, len(data), size)]
+    bad, resends, acked, n = Corrupter(corrupt), 0, 0, 0
+    while acked < len(chunks):
+        while n < len(chunks) and n < acked + ahead:
+            link.write(packet(n, 2, int(compress), chunks[n], bad(n + 1)))
+            n += 1
+        line = link.readline(30)
+        if not line: sys.exit("Timed out waiting for packet %d" % acked)
+        m = PACKET_OK.match(line)
+        if m:
+            k = int(m.group(1))
+            if k == acked & 0xFF: acked += 1
+            continue
+        m = PACKET_RESEND.match(line)
+        if m and int(m.group(1)) == acked & 0xFF:
+            n, resends = acked, resends + 1
+        elif line.startswith("fe"):
+            sys.exit("Fatal stream error at packet %d" % acked)
+    link.write(packet(n, 0, 2))                       # CLOSE
+    while not PACKET_OK.match(link.readline(5)): pass
+    return resends
+
+MODES = {
+  "ok":        (0, stream_ok),
+  "window":    (1, stream_window),
+  "packet":    (2, lambda link, cmds, corrupt: stream_packets(link, cmds, corrupt, False)),
+  "packet-hs": (2, lambda link, cmds, corrupt: stream_packets(link, cmds, corrupt, True)),
+}
+
+def load(path, count):
+    if not path: return ["G92 E0"] * count
+    cmds = []
+    with open(path) as f:
+        for line in f:
+            line = line.split(";")[0].strip()
+            if line: cmds.append(line)
+    return cmds[:count] if count else cmds
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("-m", "--marlin", required=True, help="The LINUX simulator, built with STREAM_WINDOW and/or BINARY_GCODE_STREAM")
+    parser.add_argument("-f", "--file", help="G-code to stream (default: G92 E0 lines)")
+    parser.add_argument("-n", "--lines", type=int, default=0, help="Lines to stream (default: the whole file or 5000)")
+    parser.add_argument("-l", "--latency", type=float, default=1.0, help="Round trip of the link in ms (default=1)")
+    parser.add_argument("-c", "--corrupt", type=int, default=0, help="Corrupt every n-th line or packet once")
+    parser.add_argument("--modes", default=",".join(MODES), help="Comma-separated modes to compare (default: all the simulator has)")
+    args = parser.parse_args()
+
+    cmds = load(args.file, args.lines or (0 if args.file else 5000))
+    link = connect(args.marlin, args.latency / 1000)
+    try:
+        caps = command(link, "M115")
+        has = { 0: True, 1: "Cap:STREAM_WINDOW:1" in caps, 2: "Cap:BINARY_GCODE_STREAM:1" in caps }
+        first = None
+        for name in args.modes.split(","):
+            mode, fn = MODES[name]
+            if not has[mode]: continue
+            command(link, "M110 N0")
+            start, sent = time.monotonic(), link.sent
+            resends = fn(link, cmds, args.corrupt)
+            command(link, "M400")
+            secs, sent = time.monotonic() - start, link.sent - sent
+            line = "%-10s %d lines in %.2fs = %6.0f lines/s, %7d bytes (%4.1f/line), %d resends" % (
+                name + ":", len(cmds), secs, len(cmds) / secs, sent, sent / len(cmds), resends)
+            if first: line += "  %.1fx the lines/s, %.2fx the bytes" % (first[0] / secs, sent / first[1])
+            else: first = (secs, sent)
+            print(line)
+    finally:
+        link.close()
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+"""
+Residual vibration of LINUX simulator position traces.
+
+Puts a mass on a spring (the given resonant frequency and damping) behind
+each motor of a --trace file, drives it with the motor positions, and
+reports how much the head rings. Ringing is the head's deflection from the
+motor minus its average over one period of the resonance, which leaves out
+the steady deflection while accelerating. Also reports how far the motors
+trail the commanded path. Compare a build with INPUT_SHAPING_[XY] against
+one without:
+
+  program --trace=plain.csv < print.gcode
+  program --trace=shaped.csv < print.gcode
+  shaping_trace.py -f 40 -z 0.1 plain.csv shaped.csv
+"""
+
+import argparse, csv, math
+
+def load(path):
+    """Rows of ms, x, y, motor_x, motor_y. Idle gaps break the trace into runs."""
+    runs, run, last = [], [], None
+    with open(path) as f:
+        for row in csv.reader(f):
+            t, x, y, mx, my = map(float, row)
+            if last is not None and t - last > 1.5:
+                runs.append(run)
+                run = []
+            run.append((t, x, y, mx, my))
+            last = t
+    if run: runs.append(run)
+    return runs
+
+def ring(motor, freq, zeta, dt):
+    """Deflection of a base-excited damped oscillator, integrated in 10 substeps per sample."""
+    w, sub = 2 * math.pi * freq, 10
+    h = dt / sub
+    x, v, out = motor[0], 0.0, []
+    for i in range(len(motor)):
+        m0, m1 = motor[max(i - 1, 0)], motor[i]
+        mv = (m1 - m0) / dt
+        for k in range(sub):
+            m = m0 + (m1 - m0) * (k + 1) / sub
+            v += (-2 * zeta * w * (v - mv) - w * w * (x - m)) * h
+            x += v * h
+        out.append(x - m1)
+    return out
+
+def residual(defl, period):
+    """Deflection minus its moving average over one period."""
+    n = max(1, int(round(period)))
+    acc, out = 0.0, []
+    for i, d in enumerate(defl):
+        acc += d
+        if i >= n: acc -= defl[i - n]
+        out.append(d - acc / min(i + 1, n))
+    return out
+
+def analyze(path, freq, zeta):
+    samples, sq_sum, peak, lag_sq, lag_peak = 0, 0.0, 0.0, 0.0, 0.0
+    for run in load(path):
+        if len(run) < 3: continue
+        dt = (run[-1][0] - run[0][0]) / (len(run) - 1) * 1e-3
+        period = 1 / (freq * dt)
+        rx = residual(ring([r[3] for r in run], freq, zeta, dt), period)
+        ry = residual(ring([r[4] for r in run], freq, zeta, dt), period)
+        for r, ex, ey in zip(run, rx, ry):
+            e = math.hypot(ex, ey)
+            lag = math.hypot(r[3] - r[1], r[4] - r[2])
+            sq_sum += e * e
+            lag_sq += lag * lag
+            peak, lag_peak = max(peak, e), max(lag_peak, lag)
+            samples += 1
+    if not samples: return None
+    return { "samples": samples, "ringing_rms": math.sqrt(sq_sum / samples), "ringing_max": peak,
+             "lag_rms": math.sqrt(lag_sq / samples), "lag_max": lag_peak }
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("trace", nargs="+", help="CSV file(s) written with --trace")
+    parser.add_argument("-f", "--freq", type=float, default=40, help="Resonant frequency in Hz (default=40)")
+    parser.add_argument("-z", "--zeta", type=float, default=0.1, help="Damping ratio (default=0.1)")
+    args = parser.parse_args()
+
+    first = None
+    for path in args.trace:
+        r = analyze(path, args.freq, args.zeta)
+        if not r:
+            print("%s: no motion" % path)
+            continue
+        line = "%s: %d samples  ringing rms %.4fmm max %.4fmm  motor lag rms %.4fmm max %.4fmm" % (
+            path, r["samples"], r["ringing_rms"], r["ringing_max"], r["lag_rms"], r["lag_max"])
+        if first: line += "  ringing %+.1f%%" % (100 * (r["ringing_rms"] / first["ringing_rms"] - 1))
+        else: first = r
+        print(line)
+
+if __name__ == "__main__":
+    main()